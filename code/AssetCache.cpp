@@ -0,0 +1,73 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the program file which implements the asset cache class to:
+ - Load every texture, image and font file once per run and hand out references to the loaded copy after that
+ - Remember files that failed to load so they aren't retried every time something asks for them
+ - Keep load statistics (files loaded, failed, reused, and time spent loading) for the performance panel
+*/
+
+#include "AssetCache.h"
+#include "Profiler.h"
+#include <chrono>
+
+/**
+ * Function to find an asset in a cache map, loading it into the map the first time.
+ *
+ * Parameters:
+ * @param assets - the map of loaded assets of this type
+ * @param path - the file to load
+ * @param stats - the statistics to count the request in
+ *
+ * Returns:
+ * @return the loaded asset, or nullptr if the file couldn't be loaded
+ */
+template <typename Asset>
+static const Asset* findOrLoad(std::unordered_map<std::string, std::unique_ptr<Asset>>& assets, const std::string& path, AssetStats& stats)
+{
+    //already asked for, hand out what was loaded (or the remembered failure)
+    auto found = assets.find(path);
+    if (found != assets.end())
+    {
+        stats.reused++;
+        return found->second.get();
+    }
+
+    //first request, read the file
+    PROFILE_ZONE(ZONE_LOAD_ASSETS);
+    auto start = std::chrono::steady_clock::now();
+    std::unique_ptr<Asset> asset(new Asset());
+    if (asset->loadFromFile(path))
+    {
+        stats.loaded++;
+    }
+    else
+    {
+        stats.failed++;
+        asset.reset();
+    }
+    stats.loadMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return (assets[path] = std::move(asset)).get();
+}
+
+const Texture* AssetCache::getTexture(const std::string& path)
+{
+    return findOrLoad(m_Textures, path, m_Stats);
+}
+
+const Image* AssetCache::getImage(const std::string& path)
+{
+    return findOrLoad(m_Images, path, m_Stats);
+}
+
+const Font* AssetCache::getFont(const std::string& path)
+{
+    return findOrLoad(m_Fonts, path, m_Stats);
+}
+
+const AssetStats& AssetCache::getStats() const
+{
+    return m_Stats;
+}
@@ -0,0 +1,79 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the asset cache class to:
+ - Load every texture, image and font file once per run and hand out references to the loaded copy after that
+ - Remember files that failed to load so they aren't retried every time something asks for them
+ - Keep load statistics (files loaded, failed, reused, and time spent loading) for the performance panel
+*/
+
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+using namespace sf;
+
+//how much work the cache has done so far
+struct AssetStats
+{
+    int loaded = 0; //files read from disk
+    int failed = 0; //files that couldn't be read (asked for once)
+    int reused = 0; //requests answered without touching the disk
+    double loadMs = 0; //time spent reading files
+};
+
+class AssetCache
+{
+private:
+    //creating the loaded assets by path (a missing value means the file failed to load)
+    std::unordered_map<std::string, std::unique_ptr<Texture>> m_Textures;
+    std::unordered_map<std::string, std::unique_ptr<Image>> m_Images;
+    std::unordered_map<std::string, std::unique_ptr<Font>> m_Fonts;
+    AssetStats m_Stats;
+
+public:
+    /**
+     * Function to get a texture, loading the file the first time it is asked for.
+     *
+     * Parameters:
+     * @param path - the image file to load
+     *
+     * Returns:
+     * @return the loaded texture (lives as long as the cache), or nullptr if the file couldn't be loaded
+     */
+    const Texture* getTexture(const std::string& path);
+
+    /**
+     * Function to get an image (pixels kept in memory, for building textures out of), loading the file the first time it is asked for.
+     *
+     * Parameters:
+     * @param path - the image file to load
+     *
+     * Returns:
+     * @return the loaded image (lives as long as the cache), or nullptr if the file couldn't be loaded
+     */
+    const Image* getImage(const std::string& path);
+
+    /**
+     * Function to get a font, loading the file the first time it is asked for.
+     *
+     * Parameters:
+     * @param path - the font file to load
+     *
+     * Returns:
+     * @return the loaded font (lives as long as the cache), or nullptr if the file couldn't be loaded
+     */
+    const Font* getFont(const std::string& path);
+
+    /**
+     * Function to simply get the load statistics
+     *
+     * Returns:
+     * @return how many files were loaded, failed, and reused, and how long loading took
+     */
+    const AssetStats& getStats() const;
+};
@@ -0,0 +1,305 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the program file which implements the game renderer class to:
+ - Pack the images for every object in the game from the shared asset cache into one atlas texture
+ - Keep the background and mushrooms drawn on a layer texture, redrawing only the cells whose mushroom changed
+ - Draw the current state of a world onto the game window: the layer as one quad, then the ship, lasers, spider, and centipede as one batch of quads
+*/
+
+#include "GameRenderer.h"
+#include "Profiler.h"
+
+GameRenderer::GameRenderer(RenderWindow* window, AssetCache* assets, const VertexArray& background)
+{
+    //initialize the window for drawing
+    m_Window = window;
+    m_Quads.setPrimitiveType(Quads);
+    m_Patches.setPrimitiveType(Quads);
+
+    //drawing the background once to wipe the layer's cells back to
+    //if either texture can't be made, the background and mushrooms are drawn every frame instead
+    m_Background = background;
+    Vector2u size = window->getSize();
+    m_LayerLoad = m_BackgroundTexture.create(size.x, size.y) && m_Layer.create(size.x, size.y);
+    if (m_LayerLoad)
+    {
+        m_BackgroundTexture.clear();
+        m_BackgroundTexture.draw(m_Background);
+        m_BackgroundTexture.display();
+        m_LayerSprite.setTexture(m_Layer.getTexture());
+    }
+
+    //packing every image into the atlas in the order of the frames
+    //an image that doesn't load is drawn as a colored rectangle instead (or not at all for the centipede)
+    std::vector<std::string> paths(FRAME_COUNT);
+    paths[FRAME_SHIP] = "graphics/StarShip.png";
+    paths[FRAME_SPIDER] = "graphics/Spider.png";
+    paths[FRAME_HEAD] = "graphics/CentipedeHead.png";
+    paths[FRAME_BODY] = "graphics/CentipedeBody.png";
+    paths[FRAME_MUSHROOM0] = "graphics/Mushroom0.png";
+    paths[FRAME_MUSHROOM1] = "graphics/Mushroom1.png";
+    paths[FRAME_MUSHROOM2] = "graphics/Mushroom2.png";
+    paths[FRAME_MUSHROOM3] = "graphics/Mushroom3.png";
+    m_Atlas.build(assets, paths);
+}
+
+void GameRenderer::draw(World& world, float alpha)
+{
+    //drawing the background and mushrooms first, from the layer if there is one
+    {
+        PROFILE_ZONE(ZONE_DRAW_MUSHROOMS);
+        if (m_LayerLoad)
+        {
+            updateLayer(world);
+            m_Window->draw(m_LayerSprite);
+            m_Quads.clear();
+        }
+        else
+        {
+            //no layer, so the background is drawn and every mushroom is added to the batch a health band at a time
+            m_Window->draw(m_Background);
+            m_Quads.clear();
+            MushroomStore& mushrooms = world.getMushrooms();
+            for (int band = 0; band < MushroomGrid::getBandCount(); ++band)
+            {
+                m_BandShrooms.clear();
+                world.getMushroomGrid().gatherBand(band, m_BandShrooms);
+                for (int m = 0; m < (int) m_BandShrooms.size(); ++m)
+                {
+                    drawMushroom(mushrooms.getPosition(m_BandShrooms[m]), band);
+                }
+            }
+        }
+    }
+
+    //gathering the moving objects into the batch in the order they are layered (the ones added later are drawn on top), starting with the ship and shots
+    {
+        PROFILE_ZONE(ZONE_DRAW_SHIP);
+        drawShip(world.getShip(), alpha);
+    }
+
+    //adding the spider
+    {
+        PROFILE_ZONE(ZONE_DRAW_SPIDER);
+        drawSpider(world.getSpider(), alpha);
+    }
+
+    //adding all of the centipede segments
+    {
+        PROFILE_ZONE(ZONE_DRAW_CENTIPEDE);
+        SlotMap<Centipede>& centipede = world.getCentipede();
+        for (int i = 0; i < (int) centipede.size(); ++i)
+        {
+            drawSegment(centipede[i], alpha);
+        }
+    }
+
+    //drawing the whole batch with the atlas at once
+    if (m_Quads.getVertexCount() > 0)
+    {
+        m_Window->draw(m_Quads, RenderStates(&m_Atlas.getTexture()));
+    }
+}
+
+void GameRenderer::updateLayer(World& world)
+{
+    //finding the cells that look different than when the layer was last drawn
+    //a copy that didn't match the grid (the first frame) lists every mushroom, so the whole layer is wiped instead of single cells
+    const MushroomGrid& grid = world.getMushroomGrid();
+    m_ChangedCells.clear();
+    bool matched = grid.gatherChanges(m_LayerBands, m_ChangedCells);
+    if (matched && m_ChangedCells.empty())
+    {
+        return;
+    }
+
+    //wiping the changed cells back to the background (cells never overlap, a mushroom fits inside its own)
+    float cellSize = MushroomGrid::getCellSize();
+    if (!matched)
+    {
+        m_Layer.draw(Sprite(m_BackgroundTexture.getTexture()));
+    }
+    else
+    {
+        m_Patches.clear();
+        for (int i = 0; i < (int) m_ChangedCells.size(); ++i)
+        {
+            Vector2f corner((m_ChangedCells[i] % grid.getColumns()) * cellSize, (m_ChangedCells[i] / grid.getColumns()) * cellSize);
+            m_Patches.append(Vertex(corner, corner));
+            m_Patches.append(Vertex(corner + Vector2f(cellSize, 0), corner + Vector2f(cellSize, 0)));
+            m_Patches.append(Vertex(corner + Vector2f(cellSize, cellSize), corner + Vector2f(cellSize, cellSize)));
+            m_Patches.append(Vertex(corner + Vector2f(0, cellSize), corner + Vector2f(0, cellSize)));
+        }
+        m_Layer.draw(m_Patches, RenderStates(&m_BackgroundTexture.getTexture()));
+    }
+
+    //drawing the mushroom still in each changed cell with the image of its health band
+    MushroomStore& mushrooms = world.getMushrooms();
+    m_Quads.clear();
+    for (int i = 0; i < (int) m_ChangedCells.size(); ++i)
+    {
+        int index = grid.get(m_ChangedCells[i] % grid.getColumns(), m_ChangedCells[i] / grid.getColumns());
+        if (index != -1)
+        {
+            drawMushroom(mushrooms.getPosition(index), MushroomGrid::getBand(mushrooms.getHealth(index)));
+        }
+    }
+    if (m_Quads.getVertexCount() > 0)
+    {
+        m_Layer.draw(m_Quads, RenderStates(&m_Atlas.getTexture()));
+    }
+    m_Layer.display();
+}
+
+bool GameRenderer::appendSprite(Vector2f position, Frame frame)
+{
+    //ensuring the image was loaded
+    const IntRect* rect = m_Atlas.getFrame(frame);
+    if (rect == nullptr)
+    {
+        return false;
+    }
+
+    //adding the corners clockwise from the top left, each with its corner of the image
+    float width = (float) rect->width;
+    float height = (float) rect->height;
+    Vector2f corner((float) rect->left, (float) rect->top);
+    m_Quads.append(Vertex(position, corner));
+    m_Quads.append(Vertex(position + Vector2f(width, 0), corner + Vector2f(width, 0)));
+    m_Quads.append(Vertex(position + Vector2f(width, height), corner + Vector2f(width, height)));
+    m_Quads.append(Vertex(position + Vector2f(0, height), corner + Vector2f(0, height)));
+    return true;
+}
+
+void GameRenderer::appendTurnedSprite(Vector2f position, Frame frame, int quarterTurns)
+{
+    //ensuring the image was loaded
+    const IntRect* rect = m_Atlas.getFrame(frame);
+    if (rect == nullptr)
+    {
+        return;
+    }
+
+    //turning each corner around the center of the image (a quarter turn clockwise takes x, y to -y, x since y points down)
+    static const float turnCos[4] = { 1, 0, -1, 0 };
+    static const float turnSin[4] = { 0, 1, 0, -1 };
+    float cosine = turnCos[quarterTurns & 3];
+    float sine = turnSin[quarterTurns & 3];
+    float halfWidth = rect->width / 2.f;
+    float halfHeight = rect->height / 2.f;
+    Vector2f center = position + Vector2f(halfWidth, halfHeight);
+    Vector2f corner((float) rect->left, (float) rect->top);
+    const float cornersX[4] = { -halfWidth, halfWidth, halfWidth, -halfWidth };
+    const float cornersY[4] = { -halfHeight, -halfHeight, halfHeight, halfHeight };
+    for (int i = 0; i < 4; ++i)
+    {
+        Vector2f turned(cornersX[i] * cosine - cornersY[i] * sine, cornersX[i] * sine + cornersY[i] * cosine);
+        m_Quads.append(Vertex(center + turned, corner + Vector2f(cornersX[i] + halfWidth, cornersY[i] + halfHeight)));
+    }
+}
+
+void GameRenderer::appendBox(Vector2f position, Vector2f size, Color color)
+{
+    //every corner takes the atlas's white pixel, so the quad is just the color
+    Vector2f white = m_Atlas.getWhitePixel();
+    m_Quads.append(Vertex(position, color, white));
+    m_Quads.append(Vertex(position + Vector2f(size.x, 0), color, white));
+    m_Quads.append(Vertex(position + size, color, white));
+    m_Quads.append(Vertex(position + Vector2f(0, size.y), color, white));
+}
+
+void GameRenderer::drawShip(StarShip& ship, float alpha)
+{
+    //first add the ship
+    Vec2 drawPosition = ship.getInterpolatedPosition(alpha);
+    Vector2f position(drawPosition.x, drawPosition.y);
+    if (!appendSprite(position, FRAME_SHIP))
+    {
+        //image didn't load, add the purple rectangle (with a white outline one pixel around it)
+        appendBox(position - Vector2f(1, 1), m_ShipSize + Vector2f(2, 2), Color::White);
+        appendBox(position, m_ShipSize, m_ShipColor);
+    }
+
+    //now add every laser in flight
+    LaserPool& lasers = ship.getLasers();
+    for (int i = 0; i < lasers.getActiveCount(); ++i)
+    {
+        Laser& shot = lasers.getActive(i);
+        if (shot.getHealth() <= 0)
+        {
+            //skip drawing a shot that hit something this tick
+            continue;
+        }
+        Vec2 shotPosition = shot.getInterpolatedPosition(alpha);
+        appendBox(Vector2f(shotPosition.x, shotPosition.y), Vector2f(m_LaserWidth, m_LaserHeight), m_LaserColor);
+    }
+}
+
+void GameRenderer::drawMushroom(Bounds mushroom, int band)
+{
+    //picking the image based on the mushroom's health band
+    //mushroom 0 for basically no damage, 1 for partial damage, 2 for extensive damage, and 3 for the final bit of health
+    Frame frame = (Frame) (FRAME_MUSHROOM0 + band);
+
+    //ensuring the image was loaded
+    Vector2f position(mushroom.left, mushroom.top);
+    if (!appendSprite(position, frame))
+    { //didn't load, add the purple square
+        appendBox(position, m_MushroomSize, m_MushroomColor);
+    }
+}
+
+void GameRenderer::drawSpider(Spider& spider, float alpha)
+{
+    //don't draw the spider if dead
+    if (spider.getHealth() <= 0)
+    { //spider is dead, don't draw it
+        return;
+    }
+
+    //add the spider if loaded
+    Vec2 drawPosition = spider.getInterpolatedPosition(alpha);
+    Vector2f position(drawPosition.x, drawPosition.y);
+    if (!appendSprite(position, FRAME_SPIDER))
+    {
+        //image didn't load, add the purple rectangle (with a white outline one pixel around it)
+        appendBox(position - Vector2f(1, 1), m_SpiderSize + Vector2f(2, 2), Color::White);
+        appendBox(position, m_SpiderSize, m_SpiderColor);
+    }
+}
+
+void GameRenderer::drawSegment(Centipede& segment, float alpha)
+{
+    //based on the type of the segment, draw it differently
+    Vec2 drawPosition = segment.getInterpolatedPosition(alpha);
+    Vector2f position(drawPosition.x, drawPosition.y);
+    if (segment.getType() == BODY || segment.getType() == TAIL)
+    {
+        //just add the body type, orientation doesn't matter
+        appendSprite(position, FRAME_BODY);
+        return;
+    }
+
+    //based on the orientation of the head, turn the image
+    int quarterTurns;
+    if (segment.getDirectionY() == -1)
+    { //point the head upwards
+        quarterTurns = 3;
+    }
+    else if (segment.getDirectionY() == 1)
+    { //point the head downwards
+        quarterTurns = 1;
+    }
+    else if (segment.getDirectionX() == 1)
+    { //point the head right
+        quarterTurns = 0;
+    }
+    else
+    { //point the head left
+        quarterTurns = 2;
+    }
+    appendTurnedSprite(position, FRAME_HEAD, quarterTurns);
+}
@@ -0,0 +1,164 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the game renderer class to:
+ - Pack the images for every object in the game from the shared asset cache into one atlas texture
+ - Keep the background and mushrooms drawn on a layer texture, redrawing only the cells whose mushroom changed
+ - Draw the current state of a world onto the game window: the layer as one quad, then the ship, lasers, spider, and centipede as one batch of quads
+*/
+
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "World.h"
+#include "AssetCache.h"
+#include "SpriteAtlas.h"
+
+using namespace sf;
+
+class GameRenderer
+{
+private:
+    //which image of the atlas each object is drawn with (in the order they are packed)
+    enum Frame
+    {
+        FRAME_SHIP,
+        FRAME_SPIDER,
+        FRAME_HEAD,
+        FRAME_BODY,
+        FRAME_MUSHROOM0,
+        FRAME_MUSHROOM1,
+        FRAME_MUSHROOM2,
+        FRAME_MUSHROOM3,
+        FRAME_COUNT
+    };
+
+    //creating necessary objects for drawing
+    RenderWindow *m_Window;
+    SpriteAtlas m_Atlas; //every image of the game packed into one texture
+    VertexArray m_Quads; //everything on the playing field as one batch of quads (drawn all at once, kept to reuse its memory)
+
+    //creating the mushroom layer (the background with every mushroom on it, so a frame doesn't redraw the whole field)
+    VertexArray m_Background; //the background gradient
+    RenderTexture m_BackgroundTexture; //the background drawn once, changed cells of the layer are wiped back to it
+    RenderTexture m_Layer; //the background with the mushrooms on it
+    Sprite m_LayerSprite;
+    bool m_LayerLoad; //whether the layer could be made (if not, the background and every mushroom are drawn each frame)
+    std::vector<uint64_t> m_LayerBands[4]; //the health bands of the field the layer was last drawn from (one per MushroomGrid band)
+    std::vector<int> m_ChangedCells; //the cells being redrawn (kept to reuse its memory)
+    VertexArray m_Patches; //the changed cells as quads of the background texture (kept to reuse its memory)
+
+    //setting constant values for the quads drawn when an image didn't load
+    const Vector2f m_ShipSize = Vector2f(20, 30);
+    const Color m_ShipColor = Color(200, 40, 200);
+    const Vector2f m_SpiderSize = Vector2f(60, 40);
+    const Color m_SpiderColor = Color(100, 40, 100);
+    const Vector2f m_MushroomSize = Vector2f(30, 30);
+    const Color m_MushroomColor = Color(200, 100, 200);
+
+    //setting constant values for the lasers
+    const Color m_LaserColor = Color(200, 50, 50);
+    const float m_LaserWidth = 6;
+    const float m_LaserHeight = 16;
+
+    std::vector<int> m_BandShrooms; //the mushrooms of the band being drawn (kept to reuse its memory)
+
+    /**
+     * Private function to add an image of the atlas to the batch.
+     *
+     * Parameters:
+     * @param position - where the top left corner of the image goes
+     * @param frame - which image of the atlas to add
+     *
+     * Returns:
+     * @return whether it was added (false if the image didn't load)
+     */
+    bool appendSprite(Vector2f position, Frame frame);
+
+    /**
+     * Private function to add an image of the atlas to the batch turned a number of quarter turns clockwise around its center.
+     *
+     * Parameters:
+     * @param position - where the top left corner of the image would go if it wasn't turned
+     * @param frame - which image of the atlas to add
+     * @param quarterTurns - how many quarter turns clockwise to turn it (0 to 3)
+     */
+    void appendTurnedSprite(Vector2f position, Frame frame, int quarterTurns);
+
+    /**
+     * Private function to add a solid colored rectangle to the batch.
+     *
+     * Parameters:
+     * @param position - where the top left corner of the rectangle goes
+     * @param size - the width and height of the rectangle
+     * @param color - the color to fill it with
+     */
+    void appendBox(Vector2f position, Vector2f size, Color color);
+
+    /**
+     * Private function to redraw the cells of the layer whose mushroom was added, removed, or moved to another health band.
+     *  Checking for changes costs the same however many mushrooms there are, and a frame without any draws nothing.
+     *
+     * Parameters:
+     * @param world - the world whose mushroom field the layer shows
+     */
+    void updateLayer(World& world);
+
+    /**
+     * Private function to add the starship and its live lasers to the batch.
+     *
+     * Parameters:
+     * @param ship - the starship to draw
+     * @param alpha - how far between the last two world ticks to draw the moving objects
+     */
+    void drawShip(StarShip& ship, float alpha);
+
+    /**
+     * Private function to add a mushroom to the batch using the correct image for its health band.
+     *
+     * Parameters:
+     * @param mushroom - the bounds of the mushroom to draw
+     * @param band - the health band the mushroom is in (see MushroomGrid::getBand)
+     */
+    void drawMushroom(Bounds mushroom, int band);
+
+    /**
+     * Private function to add the spider to the batch if it is alive.
+     *
+     * Parameters:
+     * @param spider - the spider to draw
+     * @param alpha - how far between the last two world ticks to draw the moving objects
+     */
+    void drawSpider(Spider& spider, float alpha);
+
+    /**
+     * Private function to add a centipede segment to the batch based on the type and orientation.
+     *
+     * Parameters:
+     * @param segment - the centipede segment to draw
+     * @param alpha - how far between the last two world ticks to draw the moving objects
+     */
+    void drawSegment(Centipede& segment, float alpha);
+
+public:
+    /**
+     * Constructor for the GameRenderer class which packs every image for the game from the asset cache into its atlas.
+     *
+     * Parameters:
+     * @param window - pointer to the window which is displaying the game
+     * @param assets - pointer to the cache the images are loaded from (only used while constructing)
+     * @param background - the background drawn under everything (the size of the window)
+     */
+    GameRenderer(RenderWindow* window, AssetCache* assets, const VertexArray& background);
+
+    /**
+     * Function to draw the background and every object of the world in two draw calls (does not clear or display the window).
+     *  Moving objects are drawn part of the way between their last two ticks so motion is smooth at any refresh rate.
+     *
+     * Parameters:
+     * @param world - the world to draw
+     * @param alpha - how far between the previous tick (0) and the latest tick (1) to draw the moving objects
+     */
+    void draw(World& world, float alpha);
+};
@@ -1,34 +1,47 @@
 /*
 Author: Dawson Pent
-Last Date Modified: 9/24/24
+Last Date Modified: 10/17/26
 
 Description:
 This is the program file which implements the overlay class to:
  - Display overlay information while the game is running including:
     > score (with a simple number)
     > lives (via displaying a starship per starship health)
+    > performance panel when toggled (FPS, frame time graph, per-phase milliseconds, object and collision counts)
 */
 
 #include "InformationOverlay.h"
+#include <algorithm>
+#include <cstdio>
 
-Overlay::Overlay(int health, int windowWidth, RenderWindow *window)
+Overlay::Overlay(int health, int windowWidth, RenderWindow *window, AssetCache* assets)
 {
     // Simply initialize the values
     //setting basic values
     m_Health = health;
     m_Score = 0;
     m_WindowWidth = windowWidth;
-    //setting up window
+    //setting up window and the cache the font and image come from (only loaded the first time)
     m_Window = window;
+    m_Assets = assets;
+    const Font* font = assets->getFont("fonts/PressStart.ttf");
+    m_ShipImage = assets->getTexture("graphics/StarShip.png");
     //setting up score display
-    m_Font.loadFromFile("fonts/PressStart.ttf");
-    m_ScoreText.setFont(m_Font);
+    if (font != nullptr) m_ScoreText.setFont(*font);
     m_ScoreText.setPosition(sf::Vector2f(((float) windowWidth) / 2.0f, 50.0f));
     m_ScoreText.setString("Hello World");
     m_ScoreText.setFillColor(Color::White);
-    //setting up ship image to display lives left
-    m_ShipImage.loadFromFile("graphics/StarShip.png");
-    m_ShipSprite.setTexture(m_ShipImage);
+    //setting up the batch of ship images to display lives left
+    m_ShipIcons.setPrimitiveType(Quads);
+    //setting up the performance panel to the left of the score
+    m_PanelShape.setSize(Vector2f(m_PanelWidth, 380));
+    m_PanelShape.setPosition(((float) windowWidth) / 2.0f - m_PanelWidth - 40.0f, 40.0f);
+    m_PanelShape.setFillColor(Color(0, 0, 0, 160));
+    if (font != nullptr) m_PerformanceText.setFont(*font);
+    m_PerformanceText.setCharacterSize(12);
+    m_PerformanceText.setFillColor(Color::White);
+    m_PerformanceText.setPosition(m_PanelShape.getPosition() + Vector2f(10.0f, 10.0f + m_GraphHeight + 10.0f));
+    m_FrameGraph.setPrimitiveType(Lines);
 }
 
 void Overlay::setHealth(int health)
@@ -37,14 +50,112 @@ void Overlay::setHealth(int health)
     m_Health = health;
 }
 
+void Overlay::setProfiler(Profiler* profiler)
+{
+    m_Profiler = profiler;
+}
+
+void Overlay::togglePerformance()
+{
+    m_ShowPerformance = !m_ShowPerformance;
+}
+
 void Overlay::draw(int score)
 {
     //draws the score and health values on the in-game screen
     m_ScoreText.setString(std::to_string(score));
     m_Window -> draw(m_ScoreText);
-    for (int i = 0; i < m_Health; ++i) {
-        // Sprite sprite;
-        m_ShipSprite.setPosition(sf::Vector2f(((float) m_WindowWidth) / 1.5f + 50.0f * i, 50.0f));
-        m_Window -> draw(m_ShipSprite);
+    if (m_ShipImage != nullptr)
+    {
+        //one ship image per life, all drawn at once
+        Vector2f size((float) m_ShipImage->getSize().x, (float) m_ShipImage->getSize().y);
+        m_ShipIcons.clear();
+        for (int i = 0; i < m_Health; ++i) {
+            Vector2f position(((float) m_WindowWidth) / 1.5f + 50.0f * i, 50.0f);
+            m_ShipIcons.append(Vertex(position, Vector2f(0, 0)));
+            m_ShipIcons.append(Vertex(position + Vector2f(size.x, 0), Vector2f(size.x, 0)));
+            m_ShipIcons.append(Vertex(position + size, size));
+            m_ShipIcons.append(Vertex(position + Vector2f(0, size.y), Vector2f(0, size.y)));
+        }
+        m_Window -> draw(m_ShipIcons, RenderStates(m_ShipImage));
+    }
+
+    //drawing the performance panel if toggled on
+    if (m_ShowPerformance)
+    {
+        drawPerformance();
     }
 }
+
+void Overlay::drawPerformance()
+{
+    //ensuring there is a finished frame to show
+    if (m_Profiler == nullptr || m_Profiler->getFrameCount() == 0)
+    {
+        return;
+    }
+    uint64_t frames = m_Profiler->getFrameCount();
+    FrameProfile latest;
+    if (!m_Profiler->getFrame(frames - 1, latest))
+    {
+        return;
+    }
+
+    //building the frame time graph (newest frame on the right) while averaging the FPS
+    Vector2f graphCorner = m_PanelShape.getPosition() + Vector2f(10.0f, 10.0f + m_GraphHeight);
+    float graphWidth = m_PanelWidth - 20.0f;
+    float totalMs = 0;
+    int averaged = 0;
+    m_FrameGraph.clear();
+    for (int i = 0; i < m_GraphFrames && (uint64_t) i < frames; ++i)
+    {
+        FrameProfile profile;
+        if (!m_Profiler->getFrame(frames - 1 - i, profile))
+        {
+            break;
+        }
+        if (i < m_FpsFrames)
+        {
+            totalMs += profile.frameMs;
+            averaged++;
+        }
+        //one vertical line per frame, red when the frame missed 60 FPS
+        float x = graphCorner.x + graphWidth - i * (graphWidth / m_GraphFrames);
+        float height = std::min(profile.frameMs / m_GraphMaxMs, 1.0f) * m_GraphHeight;
+        Color color = (profile.frameMs > 16.7f) ? Color(220, 60, 60) : Color(60, 220, 60);
+        m_FrameGraph.append(Vertex(Vector2f(x, graphCorner.y), color));
+        m_FrameGraph.append(Vertex(Vector2f(x, graphCorner.y - height), color));
+    }
+
+    //writing the FPS, every zone's time, and the counters of the latest frame
+    char line[96];
+    std::string text;
+    std::snprintf(line, sizeof(line), "FPS %.0f   frame %.2f ms\n\n", (totalMs > 0) ? 1000.0f * averaged / totalMs : 0.0f, latest.frameMs);
+    text += line;
+    for (int zone = 0; zone <= ZONE_DISPLAY; ++zone)
+    {
+        //sub-zones are indented under their phase
+        bool phase = (zone == ZONE_INPUT || zone == ZONE_UPDATE || zone == ZONE_COLLISION || zone == ZONE_DRAW || zone == ZONE_DISPLAY);
+        std::snprintf(line, sizeof(line), "%s%-18s %6.3f ms\n", phase ? "" : "  ", Profiler::getZoneName((Zone) zone), latest.zoneMs[zone]);
+        text += line;
+    }
+    std::snprintf(line, sizeof(line), "\nmushrooms %u   segments %u\ncollision tests %u (%u ticks)", latest.counters[COUNTER_MUSHROOMS],
+        latest.counters[COUNTER_SEGMENTS], latest.counters[COUNTER_COLLISION_TESTS], latest.counters[COUNTER_TICKS]);
+    text += line;
+    const AssetStats& assets = m_Assets->getStats();
+    std::snprintf(line, sizeof(line), "\nassets %d loaded (%.1f ms)   %d reused   %d failed", assets.loaded, assets.loadMs,
+        assets.reused, assets.failed);
+    text += line;
+    if (AllocationTracker::isEnabled())
+    { //only counted when built with CENTIPEDE_TRACK_ALLOCATIONS
+        std::snprintf(line, sizeof(line), "\nheap allocations %u (%u bytes)", latest.counters[COUNTER_ALLOCATIONS],
+            latest.counters[COUNTER_ALLOCATED_BYTES]);
+        text += line;
+    }
+    m_PerformanceText.setString(text);
+
+    //drawing the panel
+    m_Window -> draw(m_PanelShape);
+    m_Window -> draw(m_FrameGraph);
+    m_Window -> draw(m_PerformanceText);
+}
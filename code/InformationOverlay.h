@@ -1,16 +1,19 @@
 /*
 Author: Dawson Pent
-Last Date Modified: 9/24/24
+Last Date Modified: 10/17/26
 
 Description:
 This is the header file which describes the class to:
  - Display overlay information while the game is running including:
     > score (with a simple number)
     > lives (via displaying a starship per starship health)
+    > performance panel when toggled (FPS, frame time graph, per-phase milliseconds, object and collision counts)
 */ 
 
 #pragma once
 #include <SFML/Graphics.hpp>
+#include "Profiler.h"
+#include "AssetCache.h"
 
 using namespace sf;
 
@@ -19,18 +22,32 @@ class Overlay
 private:
     //creating necessary objects for the method
     RenderWindow* m_Window;
-    Texture m_ShipImage;
-    Sprite m_ShipSprite;
-    RectangleShape m_ShipShape;
+    const Texture* m_ShipImage; //the ship image every life is drawn with (nullptr if it didn't load)
+    VertexArray m_ShipIcons; //one quad per life left (drawn all at once, kept to reuse its memory)
     Text m_ScoreText;
-    Font m_Font;
+    Profiler* m_Profiler = nullptr; //where the performance panel reads the frame timings from
+    AssetCache* m_Assets; //where the font and ship image come from (and the load statistics for the performance panel)
+    RectangleShape m_PanelShape;
+    Text m_PerformanceText;
+    VertexArray m_FrameGraph;
 
     //setting constant values for the object
     int m_WindowWidth; //holds the width of the window
+    const int m_GraphFrames = 120; //how many of the latest frames the frame time graph shows
+    const int m_FpsFrames = 60; //how many of the latest frames the FPS is averaged over
+    const float m_PanelWidth = 420;
+    const float m_GraphHeight = 60;
+    const float m_GraphMaxMs = 33.3f; //frame time at the top of the graph
 
     //creating changing values for the object
     int m_Health; //holds the current health of the player
     int m_Score; //holds the current score of the round
+    bool m_ShowPerformance = false; //whether the performance panel is drawn
+
+    /**
+     * Private function to draw the performance panel beside the score from the profiler's latest frames.
+     */
+    void drawPerformance();
 
 public:
     /** 
@@ -40,8 +57,9 @@ public:
      * @param health - the health of the current round to identify how many ships to draw
      * @param windowWidth - integer screen width to help calculate where to put the text on the screen
      * @param window - pointer to the window which is displaying the game to draw the overlay
+     * @param assets - pointer to the cache the font and ship image are loaded from (must outlive the overlay)
      */
-    Overlay(int health, int windowWidth, RenderWindow *window);
+    Overlay(int health, int windowWidth, RenderWindow *window, AssetCache* assets);
 
     // Specific methods
 
@@ -53,10 +71,23 @@ public:
      */
     void setHealth(int health);
 
+    /**
+     * Function to set the profiler the performance panel reads from (nullptr if the game isn't being profiled)
+     *
+     * Parameters:
+     * @param profiler - pointer to the profiler recording the game loop
+     */
+    void setProfiler(Profiler* profiler);
+
+    /**
+     * Function to show the performance panel if it is hidden, or hide it if it is shown
+     */
+    void togglePerformance();
+
     // Drawing method
   
     /** 
-     * Function to draw the overlay with the ships per health and score for the game.
+     * Function to draw the overlay with the ships per health and score for the game (and the performance panel if shown).
      * 
      * Parameters:
      * @param score - what score value to draw on the overlay
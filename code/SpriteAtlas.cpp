@@ -0,0 +1,77 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the program file which implements the sprite atlas class to:
+ - Pack a list of images from the asset cache into one texture at startup, so everything using them can be drawn in a single draw call
+ - Give the texture rectangle of each packed image (or none for an image that failed to load)
+ - Keep a plain white spot in the texture for drawing solid colored quads in the same draw call
+*/
+
+#include "SpriteAtlas.h"
+#include <algorithm>
+
+bool SpriteAtlas::build(AssetCache* assets, const std::vector<std::string>& paths)
+{
+    //starting with the white spot in the corner (2 by 2 so its middle is a whole pixel inside it)
+    m_Frames.assign(paths.size(), IntRect());
+    IntRect white(m_Padding, m_Padding, 2, 2);
+    m_WhitePixel = Vector2f(white.left + 1.0f, white.top + 1.0f);
+
+    //placing each image in a row after the one before it, starting a new row when it doesn't fit across
+    std::vector<const Image*> images(paths.size(), nullptr);
+    int x = white.left + white.width + m_Padding;
+    int y = m_Padding;
+    int rowHeight = white.height;
+    for (int i = 0; i < (int) paths.size(); ++i)
+    {
+        images[i] = assets->getImage(paths[i]);
+        if (images[i] == nullptr)
+        { //didn't load, leave its frame empty
+            continue;
+        }
+        int width = (int) images[i]->getSize().x;
+        int height = (int) images[i]->getSize().y;
+        if (x + width + m_Padding > m_Width && x > m_Padding)
+        {
+            x = m_Padding;
+            y += rowHeight + m_Padding;
+            rowHeight = 0;
+        }
+        m_Frames[i] = IntRect(x, y, width, height);
+        x += width + m_Padding;
+        rowHeight = std::max(rowHeight, height);
+    }
+
+    //copying every image into its place (the rest of the texture is left see-through)
+    int widest = m_Width;
+    for (int i = 0; i < (int) m_Frames.size(); ++i)
+    {
+        widest = std::max(widest, m_Frames[i].left + m_Frames[i].width + m_Padding);
+    }
+    Image atlas;
+    atlas.create(widest, y + rowHeight + m_Padding, Color(0, 0, 0, 0));
+    Image whiteSpot;
+    whiteSpot.create(white.width, white.height, Color::White);
+    atlas.copy(whiteSpot, white.left, white.top);
+    for (int i = 0; i < (int) images.size(); ++i)
+    {
+        if (images[i] != nullptr)
+        {
+            atlas.copy(*images[i], m_Frames[i].left, m_Frames[i].top);
+        }
+    }
+    m_Loaded = m_Texture.loadFromImage(atlas);
+    return m_Loaded;
+}
+
+const IntRect* SpriteAtlas::getFrame(int frame) const
+{
+    //an image that didn't load (or every image, if the texture couldn't be made) has no frame
+    if (!m_Loaded || m_Frames[frame].width == 0)
+    {
+        return nullptr;
+    }
+    return &m_Frames[frame];
+}
@@ -0,0 +1,72 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the sprite atlas class to:
+ - Pack a list of images from the asset cache into one texture at startup, so everything using them can be drawn in a single draw call
+ - Give the texture rectangle of each packed image (or none for an image that failed to load)
+ - Keep a plain white spot in the texture for drawing solid colored quads in the same draw call
+*/
+
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "AssetCache.h"
+#include <string>
+#include <vector>
+
+using namespace sf;
+
+class SpriteAtlas
+{
+private:
+    //creating the packed texture and where each image is in it
+    Texture m_Texture;
+    std::vector<IntRect> m_Frames; //in the order the images were given (an empty rectangle for an image that didn't load)
+    Vector2f m_WhitePixel; //texture coordinates of the middle of the white spot
+    bool m_Loaded = false;
+
+    //setting constant values for the packing
+    const int m_Width = 256; //width of the texture (images are packed in rows across it)
+    const int m_Padding = 1; //empty pixels around every image so neighbours never bleed into each other
+
+public:
+    /**
+     * Function to pack the images into the texture (any images packed before are replaced).
+     *
+     * Parameters:
+     * @param assets - pointer to the cache the images are loaded from
+     * @param paths - the image files to pack (their index in this list is their frame)
+     *
+     * Returns:
+     * @return whether the texture was created (images that didn't load are skipped, not failures)
+     */
+    bool build(AssetCache* assets, const std::vector<std::string>& paths);
+
+    /**
+     * Function to get where a packed image is in the texture
+     *
+     * Parameters:
+     * @param frame - the index of the image in the list it was packed from
+     *
+     * Returns:
+     * @return pointer to the texture rectangle of the image, or nullptr if it didn't load
+     */
+    const IntRect* getFrame(int frame) const;
+
+    /**
+     * Function to simply get the texture coordinates to give every corner of a solid colored quad
+     *
+     * Returns:
+     * @return the texture coordinates of a white pixel
+     */
+    Vector2f getWhitePixel() const { return m_WhitePixel; }
+
+    /**
+     * Function to simply get the packed texture
+     *
+     * Returns:
+     * @return reference to the texture every frame is in
+     */
+    const Texture& getTexture() const { return m_Texture; }
+};
@@ -0,0 +1,164 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the program file which implements the allocation tracker to:
+ - Count every heap allocation (and the bytes asked for) made through the global operator new
+ - Charge each allocation to the profiler zone the thread is in, so hot-loop allocations can be found by zone
+ - Report the zones that allocated the most when the program exits
+*/
+
+#include "AllocationTracker.h"
+#include "Profiler.h"
+
+#ifdef CENTIPEDE_TRACK_ALLOCATIONS
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+// Counts of the calling thread (plain values so counting can't allocate or lock)
+static thread_local int threadZone = ZONE_COUNT;
+static thread_local AllocationStats threadTotals;
+
+// Counts of every zone across all threads (the last slot is outside of every zone)
+static std::atomic<uint64_t> zoneAllocations[ZONE_COUNT + 1];
+static std::atomic<uint64_t> zoneBytes[ZONE_COUNT + 1];
+static std::atomic<uint64_t> zoneEntries[ZONE_COUNT + 1];
+
+/**
+ * Function to count one allocation and get the memory for it.
+ *
+ * Parameters:
+ * @param size - how many bytes were asked for
+ *
+ * Returns:
+ * @return the memory, or nullptr if there wasn't any
+ */
+static void* trackedAllocate(std::size_t size)
+{
+    threadTotals.allocations++;
+    threadTotals.bytes += size;
+    zoneAllocations[threadZone].fetch_add(1, std::memory_order_relaxed);
+    zoneBytes[threadZone].fetch_add(size, std::memory_order_relaxed);
+    return std::malloc((size > 0) ? size : 1);
+}
+
+/**
+ * Function to count one free and give the memory back.
+ *
+ * Parameters:
+ * @param memory - the memory to free (may be nullptr)
+ */
+static void trackedFree(void* memory)
+{
+    if (memory != nullptr)
+    {
+        threadTotals.frees++;
+        std::free(memory);
+    }
+}
+
+// Replacing the global allocation functions
+void* operator new(std::size_t size)
+{
+    void* memory = trackedAllocate(size);
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return trackedAllocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return trackedAllocate(size);
+}
+
+void operator delete(void* memory) noexcept { trackedFree(memory); }
+void operator delete[](void* memory) noexcept { trackedFree(memory); }
+void operator delete(void* memory, std::size_t) noexcept { trackedFree(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { trackedFree(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { trackedFree(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { trackedFree(memory); }
+
+// Writes the report when the program exits
+static struct ExitReport
+{
+    ~ExitReport() { AllocationTracker::report(); }
+} exitReport;
+
+bool AllocationTracker::isEnabled()
+{
+    return true;
+}
+
+int AllocationTracker::enterZone(int zone)
+{
+    int previousZone = threadZone;
+    threadZone = zone;
+    zoneEntries[zone].fetch_add(1, std::memory_order_relaxed);
+    return previousZone;
+}
+
+void AllocationTracker::leaveZone(int previousZone)
+{
+    threadZone = previousZone;
+}
+
+AllocationStats AllocationTracker::getThreadTotals()
+{
+    return threadTotals;
+}
+
+void AllocationTracker::report()
+{
+    //sorting the zones by how many allocations they made
+    int order[ZONE_COUNT + 1];
+    for (int zone = 0; zone <= ZONE_COUNT; ++zone)
+    {
+        order[zone] = zone;
+    }
+    std::sort(order, order + ZONE_COUNT + 1, [](int a, int b) { return zoneAllocations[a].load() > zoneAllocations[b].load(); });
+
+    //writing every zone that allocated (allocations are charged to the innermost zone only)
+    std::fflush(stdout);
+    std::fprintf(stderr, "\nHeap allocations by zone (worst first):\n");
+    std::fprintf(stderr, "  %-18s %12s %14s %10s %12s\n", "zone", "allocations", "bytes", "entries", "allocs/entry");
+    for (int i = 0; i <= ZONE_COUNT; ++i)
+    {
+        int zone = order[i];
+        uint64_t allocations = zoneAllocations[zone].load();
+        if (allocations == 0)
+        {
+            continue;
+        }
+        uint64_t entries = zoneEntries[zone].load();
+        std::fprintf(stderr, "  %-18s %12llu %14llu %10llu %12.2f\n", (zone < ZONE_COUNT) ? Profiler::getZoneName((Zone) zone) : "(no zone)",
+            (unsigned long long) allocations, (unsigned long long) zoneBytes[zone].load(), (unsigned long long) entries,
+            (entries > 0) ? (double) allocations / entries : 0.0);
+    }
+}
+
+#else
+
+// The tracker is compiled out, nothing is counted
+bool AllocationTracker::isEnabled() { return false; }
+int AllocationTracker::enterZone(int) { return 0; }
+void AllocationTracker::leaveZone(int) {}
+AllocationStats AllocationTracker::getThreadTotals() { return AllocationStats(); }
+void AllocationTracker::report() {}
+
+#endif
@@ -0,0 +1,68 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the allocation tracker to:
+ - Count every heap allocation (and the bytes asked for) made through the global operator new
+ - Charge each allocation to the profiler zone the thread is in, so hot-loop allocations can be found by zone
+ - Report the zones that allocated the most when the program exits
+
+The tracker is opt-in: operator new / delete are only replaced when the game is built with CENTIPEDE_TRACK_ALLOCATIONS
+defined (the CMake option of the same name). Otherwise every function here returns zeros and costs nothing.
+*/
+
+#pragma once
+#include <cstdint>
+
+// Allocation counts of a thread or a zone
+struct AllocationStats
+{
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+    uint64_t frees = 0;
+};
+
+class AllocationTracker
+{
+public:
+    /**
+     * Function to see whether the tracker was compiled in
+     *
+     * Returns:
+     * @return whether allocations are being counted
+     */
+    static bool isEnabled();
+
+    /**
+     * Function to choose the zone the calling thread's allocations are charged to.
+     *
+     * Parameters:
+     * @param zone - the profiler zone being entered (ZONE_COUNT for outside of every zone)
+     *
+     * Returns:
+     * @return the zone the thread was in before, to give back when leaving
+     */
+    static int enterZone(int zone);
+
+    /**
+     * Function to go back to the zone the calling thread was in before entering the current one.
+     *
+     * Parameters:
+     * @param previousZone - what enterZone returned
+     */
+    static void leaveZone(int previousZone);
+
+    /**
+     * Function to get the running allocation totals of the calling thread (take the difference of two calls to measure a span).
+     *
+     * Returns:
+     * @return the thread's allocation counts so far
+     */
+    static AllocationStats getThreadTotals();
+
+    /**
+     * Function to write the allocation totals of every zone, worst first (done automatically at exit when enabled).
+     */
+    static void report();
+};
@@ -0,0 +1,86 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the program file which implements the automatic player class to:
+ - Give the world an input every tick without a keyboard, so matches can be played headless
+ - Either follow a fixed script (always shooting while sweeping left and right) or a simple bot
+   that lines up under the lowest centipede segment and moves out of the spider's way
+*/
+
+#include "AutoPlayer.h"
+#include <cmath>
+
+AutoPlayer::AutoPlayer(PlayerKind kind)
+{
+    m_Kind = kind;
+}
+
+void AutoPlayer::reset()
+{
+    m_Tick = 0;
+}
+
+Input AutoPlayer::getInput(World& world, float dt)
+{
+    //the bot looks at the world to decide
+    m_Tick++;
+    if (m_Kind == BOT_PLAYER)
+    {
+        return botInput(world);
+    }
+
+    //the script always shoots and switches sweep direction every few seconds of game time
+    int sweep = (int) ((m_Tick - 1) * dt / m_SweepSeconds);
+    return ACTION_SHOOT | ((sweep % 2 == 0) ? ACTION_LEFT : ACTION_RIGHT);
+}
+
+Input AutoPlayer::botInput(World& world)
+{
+    //always shooting
+    Input input = ACTION_SHOOT;
+    Bounds ship = world.getShip().getPosition();
+    float shipX = ship.left + ship.width / 2;
+
+    //moving away from the spider first if it is close and low enough to reach the ship
+    Spider& spider = world.getSpider();
+    if (spider.getHealth() > 0)
+    {
+        Bounds body = spider.getPosition();
+        float spiderX = body.left + body.width / 2;
+        if (std::abs(spiderX - shipX) < m_SpiderDodgeRange && body.top + body.height > ship.top - m_SpiderDodgeRange)
+        { //spider is close, move to whichever side it isn't on (towards the middle if against a wall)
+            bool goLeft = (spiderX > shipX) ? (ship.left > ship.width) : (ship.left + ship.width * 2 > world.getWidth());
+            return input | (goLeft ? ACTION_LEFT : ACTION_RIGHT);
+        }
+    }
+
+    //finding the lowest centipede segment to line up under
+    SlotMap<Centipede>& centipede = world.getCentipede();
+    int target = -1;
+    for (int i = 0; i < (int) centipede.size(); ++i)
+    {
+        if (target == -1 || centipede[i].getPosition().top > centipede[target].getPosition().top)
+        {
+            target = i;
+        }
+    }
+    if (target == -1)
+    { //nothing left to shoot
+        return input;
+    }
+
+    //moving towards the target until within the dead zone
+    Bounds segment = centipede[target].getPosition();
+    float targetX = segment.left + segment.width / 2;
+    if (targetX < shipX - m_AimDeadZone)
+    {
+        input |= ACTION_LEFT;
+    }
+    else if (targetX > shipX + m_AimDeadZone)
+    {
+        input |= ACTION_RIGHT;
+    }
+    return input;
+}
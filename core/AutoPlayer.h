@@ -0,0 +1,70 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the automatic player class to:
+ - Give the world an input every tick without a keyboard, so matches can be played headless
+ - Either follow a fixed script (always shooting while sweeping left and right) or a simple bot
+   that lines up under the lowest centipede segment and moves out of the spider's way
+*/
+
+#pragma once
+#include "World.h"
+
+// Public global types defined for class
+//the ways the automatic player can choose its inputs
+enum PlayerKind {
+    SCRIPTED_PLAYER = 0,
+    BOT_PLAYER = 1
+};
+
+class AutoPlayer
+{
+private:
+    //setting constant values for the player
+    PlayerKind m_Kind;
+    const float m_SweepSeconds = 2.0f; //how long the scripted player sweeps in one direction
+    const float m_SpiderDodgeRange = 150.0f; //how close (in x) the spider can get before the bot moves away
+    const float m_AimDeadZone = 10.0f; //how close (in x) to the target the bot has to be to stop moving
+
+    //creating changing values for the player
+    long m_Tick = 0; //ticks since the match began
+
+    /**
+     * Private function to pick the bot's input for the current state of the world.
+     *
+     * Parameters:
+     * @param world - the world that is being played
+     *
+     * Returns:
+     * @return the inputs to give to the world for this tick
+     */
+    Input botInput(World& world);
+
+public:
+    /**
+     * Constructor for the AutoPlayer class.
+     *
+     * Parameters:
+     * @param kind - whether to follow the fixed script or play as the bot
+     */
+    AutoPlayer(PlayerKind kind = SCRIPTED_PLAYER);
+
+    /**
+     * Function to restart the player for a new match.
+     */
+    void reset();
+
+    /**
+     * Function to get the player's input for the next tick of the world.
+     *
+     * Parameters:
+     * @param world - the world that is being played
+     * @param dt - the length of each tick in seconds
+     *
+     * Returns:
+     * @return the inputs to give to the world for this tick
+     */
+    Input getInput(World& world, float dt);
+};
@@ -0,0 +1,136 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the program file which implements the broadphase class to:
+ - Keep every moving object (ship, lasers, spider, centipede segments) sorted by its left edge between steps (sweep and prune on x)
+ - Re-sort from the last step's order with an insertion sort, which is close to linear when objects have only moved a little
+ - Hand back only the pairs of overlapping objects whose collision layers are allowed to meet (laser x segment, ship x spider, ...)
+*/
+
+#include "Broadphase.h"
+#include <algorithm>
+
+uint32_t Broadphase::getMeets(uint32_t layer) const
+{
+    //finding the index of the layer's bit
+    for (int bit = 0; bit < 32; ++bit)
+    {
+        if (layer == (1u << bit))
+        {
+            return m_Meets[bit];
+        }
+    }
+    return LAYER_NONE;
+}
+
+void Broadphase::allowPair(uint32_t layerA, uint32_t layerB)
+{
+    //letting each layer meet the other
+    for (int bit = 0; bit < 32; ++bit)
+    {
+        if (layerA == (1u << bit))
+        {
+            m_Meets[bit] |= layerB;
+        }
+        if (layerB == (1u << bit))
+        {
+            m_Meets[bit] |= layerA;
+        }
+    }
+}
+
+void Broadphase::resize(int count)
+{
+    //taking the removed proxies out of the order (the rest keep their places)
+    int oldCount = (int) m_Proxies.size();
+    if (count < oldCount)
+    {
+        m_Order.erase(std::remove_if(m_Order.begin(), m_Order.end(), [count](int id) { return id >= count; }), m_Order.end());
+    }
+
+    //adding the new proxies to the end of the order (the next update sorts them in)
+    m_Proxies.resize(count);
+    for (int id = oldCount; id < count; ++id)
+    {
+        m_Order.push_back(id);
+    }
+}
+
+void Broadphase::setProxy(int id, const Bounds& bounds, uint32_t layer)
+{
+    Proxy& proxy = m_Proxies[id];
+    proxy.left = bounds.left;
+    proxy.top = bounds.top;
+    proxy.right = bounds.left + bounds.width;
+    proxy.bottom = bounds.top + bounds.height;
+    proxy.layer = layer;
+    proxy.meets = getMeets(layer);
+}
+
+void Broadphase::setLayer(int id, uint32_t layer)
+{
+    Proxy& proxy = m_Proxies[id];
+    proxy.layer = layer;
+    proxy.meets = getMeets(layer);
+}
+
+void Broadphase::update()
+{
+    //insertion sorting the order by left edge (objects barely move between steps, so few proxies move far)
+    for (int i = 1; i < (int) m_Order.size(); ++i)
+    {
+        int id = m_Order[i];
+        float left = m_Proxies[id].left;
+        int j = i - 1;
+        while (j >= 0 && m_Proxies[m_Order[j]].left > left)
+        {
+            m_Order[j + 1] = m_Order[j];
+            j--;
+        }
+        m_Order[j + 1] = id;
+    }
+
+    //sweeping left to right, every proxy is checked against the ones the sweep is still inside of
+    m_Pairs.clear();
+    m_Active.clear();
+    for (int i = 0; i < (int) m_Order.size(); ++i)
+    {
+        int id = m_Order[i];
+        const Proxy& proxy = m_Proxies[id];
+        if (proxy.layer == LAYER_NONE)
+        {
+            continue;
+        }
+
+        for (int a = 0; a < (int) m_Active.size(); )
+        {
+            const Proxy& other = m_Proxies[m_Active[a]];
+            if (other.right <= proxy.left)
+            { //the sweep has passed this proxy, drop it
+                m_Active[a] = m_Active.back();
+                m_Active.pop_back();
+                continue;
+            }
+
+            //overlapping on x, pairing if the layers can meet and they also overlap on y
+            if ((proxy.meets & other.layer) && proxy.top < other.bottom && other.top < proxy.bottom)
+            {
+                m_Pairs.push_back({ std::min(id, m_Active[a]), std::max(id, m_Active[a]) });
+            }
+            a++;
+        }
+        m_Active.push_back(id);
+    }
+
+    //sorting the pairs so every object's pairs are together and come out the same way every run
+    std::sort(m_Pairs.begin(), m_Pairs.end(), [](const BroadphasePair& a, const BroadphasePair& b) {
+        return (a.first != b.first) ? a.first < b.first : a.second < b.second;
+    });
+}
+
+const std::vector<BroadphasePair>& Broadphase::getPairs() const
+{
+    return m_Pairs;
+}
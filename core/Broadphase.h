@@ -0,0 +1,116 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the broadphase class to:
+ - Keep every moving object (ship, lasers, spider, centipede segments) sorted by its left edge between steps (sweep and prune on x)
+ - Re-sort from the last step's order with an insertion sort, which is close to linear when objects have only moved a little
+ - Hand back only the pairs of overlapping objects whose collision layers are allowed to meet (laser x segment, ship x spider, ...)
+*/
+
+#pragma once
+#include "Geometry.h"
+#include <cstdint>
+#include <vector>
+
+// Public global types defined for class
+//the kind of object a proxy stands for (a proxy has one layer, pairs of layers are allowed to meet with allowPair)
+enum CollisionLayer : uint32_t {
+    LAYER_NONE    = 0, //an inactive proxy (dead laser or spider), never paired
+    LAYER_SHIP    = 1 << 0,
+    LAYER_LASER   = 1 << 1,
+    LAYER_SPIDER  = 1 << 2,
+    LAYER_SEGMENT = 1 << 3
+};
+
+//two proxies whose bounds overlap (first is always the lower id)
+struct BroadphasePair
+{
+    int first;
+    int second;
+};
+
+class Broadphase
+{
+private:
+    //the bounds and layers of one moving object
+    struct Proxy
+    {
+        float left = 0;
+        float top = 0;
+        float right = 0;
+        float bottom = 0;
+        uint32_t layer = LAYER_NONE;
+        uint32_t meets = LAYER_NONE; //the layers this proxy is allowed to pair with
+    };
+
+    //creating the broadphase values
+    std::vector<Proxy> m_Proxies;
+    std::vector<int> m_Order; //proxy ids sorted by left edge, kept from step to step
+    std::vector<int> m_Active; //proxies the sweep is currently inside of
+    std::vector<BroadphasePair> m_Pairs;
+    uint32_t m_Meets[32] = {}; //the layers every layer bit is allowed to pair with
+
+    /**
+     * Private function to find which layers a layer is allowed to pair with.
+     *
+     * Parameters:
+     * @param layer - the layer to look up (a single bit)
+     *
+     * Returns:
+     * @return the allowed layers as a mask
+     */
+    uint32_t getMeets(uint32_t layer) const;
+
+public:
+    /**
+     * Function to let two layers pair with each other (call once while setting up).
+     *
+     * Parameters:
+     * @param layerA - the first layer
+     * @param layerB - the second layer (can be the same as the first)
+     */
+    void allowPair(uint32_t layerA, uint32_t layerB);
+
+    /**
+     * Function to set how many proxies there are (ids 0 to count - 1).
+     *  New proxies are added to the end of the order, removed ones are taken out of it without moving the rest.
+     *
+     * Parameters:
+     * @param count - the number of proxies
+     */
+    void resize(int count);
+
+    /**
+     * Function to move a proxy and set its layer for the next update.
+     *
+     * Parameters:
+     * @param id - which proxy to set
+     * @param bounds - the area the object covers this step
+     * @param layer - the layer of the object (LAYER_NONE to leave it out of every pair)
+     */
+    void setProxy(int id, const Bounds& bounds, uint32_t layer);
+
+    /**
+     * Function to change only a proxy's layer, leaving it where it was in the order (for turning off a proxy that isn't in use).
+     *
+     * Parameters:
+     * @param id - which proxy to set
+     * @param layer - the layer of the object (LAYER_NONE to leave it out of every pair)
+     */
+    void setLayer(int id, uint32_t layer);
+
+    /**
+     * Function to re-sort the proxies and find every overlapping pair of allowed layers.
+     */
+    void update();
+
+    /**
+     * Function to simply get the pairs found by the last update
+     *
+     * Returns:
+     * @return the overlapping pairs, sorted by first then second id
+     */
+    const std::vector<BroadphasePair>& getPairs() const;
+};
@@ -1,76 +1,52 @@
 /*
 Author: Dawson Pent
-Last Date Modified: 10/1/24
+Last Date Modified: 10/17/26
 
 Description:
 This is the program file which implements the centipede class to:
  - Calculate current location and movement information for this specific segment of the centipede
  - Detect collisions between objects to do damage / change movement
  - Hold the type of centipede body part (head, end, middle)
+ - Follow the path its head left behind (only heads steer themselves)
 */
 #include "Centipede.h"
+#include <cmath>
 
-Centipede::Centipede(RenderWindow* window, BodyType type, int segmentNum, float* headRandom)
+Centipede::Centipede(float screenWidth, float screenHeight, BodyType type, int segmentNum, float* headRandom, Random& generator)
 {
-    //calculating the screen width and height while saving window pointer
-    m_Window = window;
-    m_ScreenWidth  = (float) m_Window -> getSize().x;
-    m_ScreenHeight = (float) m_Window -> getSize().y;
+    //saving the screen width and height
+    m_ScreenWidth  = screenWidth;
+    m_ScreenHeight = screenHeight;
     m_MaxHeight = m_ScreenHeight - .3f * m_ScreenHeight;
       
     //initializing movement and position information randomly
-    float random = (type == HEAD) ? ((float) std::rand()) / RAND_MAX : *headRandom;
+    float random = (type == HEAD) ? generator.nextFloat() : *headRandom;
     *headRandom = random;
     m_DirectionX = (random < .5f) ? -1 : 1;
     m_DirectionY = 2; //generally, go downward
     m_Position.x = (random < .5f) ? m_ScreenWidth + segmentNum * 35 : 0 - m_Width - segmentNum * 35;
     m_Position.y = 105;
-    m_PrevMove.x = 0;
-    m_PrevMove.y = 0;
-    m_PrevPosition = m_Position;
-
-    //initializing the shape
-    m_Shape.setSize(Vector2f(m_Width, m_Height));
-    m_Shape.setPosition(m_Position);
-
-    //initializing the sprites and textures
-    m_HeadImage.loadFromFile("graphics/CentipedeHead.png");
-    m_BodyImage.loadFromFile("graphics/CentipedeBody.png");
-    m_HeadSprite.setTexture(m_HeadImage);
-    m_BodySprite.setTexture(m_BodyImage);
-    m_Offset.x = m_HeadSprite.getLocalBounds().width / 2.f;
-    m_Offset.y = m_HeadSprite.getLocalBounds().height / 2.f;
-    m_HeadSprite.setOrigin(Vector2f(m_Offset.x, m_Offset.y));
-    m_HeadSprite.setPosition(m_Position);
-    m_BodySprite.setPosition(m_Position);
+
+    //initializing the bounds
+    m_Bounds = Bounds(m_Position.x, m_Position.y, m_Width, m_Height);
+    m_TickStartPosition = m_Position;
 
     //initializing specific values
     m_Type = type;
     m_Points = (type == HEAD) ? 100 : 10;
 }
 
-FloatRect Centipede::getPosition()
-{
-    //returning the centipede's position
-    return m_Shape.getGlobalBounds();
-}
-
-RectangleShape Centipede::getShape()
-{
-    //returning the centipede's shape
-    return m_Shape;
-}
-
-int Centipede::getPoints()
+Vec2 Centipede::getInterpolatedPosition(float alpha) const
 {
-    //returning the centipede's points
-    return m_Points;
+    //returning the position between the start and end of the last update
+    return Vec2::lerp(m_TickStartPosition, Vec2(m_Bounds.left, m_Bounds.top), alpha);
 }
 
-BodyType Centipede::getType()
+Bounds Centipede::getSweptPosition() const
 {
-    //returning the centipede's type
-    return m_Type;
+    //returning the area from the start of the last update to the current bounds
+    Bounds start(m_TickStartPosition.x, m_TickStartPosition.y, m_Bounds.width, m_Bounds.height);
+    return start.sweptArea(getMovement());
 }
 
 void Centipede::setType(BodyType type)
@@ -80,7 +56,7 @@ void Centipede::setType(BodyType type)
     m_Points = (type == HEAD) ? 100 : 10;
 }
 
-int Centipede::checkDamage(FloatRect other, int damage)
+int Centipede::checkDamage(Bounds other, int damage)
 {
     //check if they intersect. If so, do damage
     if (other.intersects(this->getPosition()))
@@ -93,7 +69,7 @@ int Centipede::checkDamage(FloatRect other, int damage)
         else if (!m_Bounce)
 	    { //no damage, just turn around centipede
 	        m_Bounce = true;
-	        if ( abs(m_DirectionY) < 2 )
+	        if ( std::abs(m_DirectionY) < 2 )
 	        { //moving down/up, stop that movement (may result in centipede overlap, thats okay)
 	            m_DirectionY *= 2;
 	            m_Position.y  = (m_DirectionY < 0) ? m_Distance + 35 : m_Distance - 35;
@@ -119,16 +95,16 @@ int Centipede::checkDamage(FloatRect other, int damage)
     return -1;
 }
 
-Vector2f Centipede::update(Time dt)
+void Centipede::update(float dt)
 {
-    //saving the current position to return
-    m_PrevPosition = m_Position;
+    //saving where the update started
+    m_TickStartPosition = Vec2(m_Bounds.left, m_Bounds.top);
 
     // Update the centipede location based on direction movement
     //move the centipede part
-    if (abs(m_DirectionY) < 2)
+    if (std::abs(m_DirectionY) < 2)
     { //moving up or down
-        m_Position.y += m_DirectionY * m_Speed * dt.asSeconds();
+        m_Position.y += m_DirectionY * m_Speed * dt;
         //checking if the centipede has moved enough (keeping it within the grid)
         if ((m_DirectionY < 0) ? m_Position.y <= m_Distance : m_Position.y >= m_Distance)
         { //centipede has moved enough up/down
@@ -139,7 +115,7 @@ Vector2f Centipede::update(Time dt)
     }
     else
     { //moving left/right
-        m_Position.x += m_DirectionX * m_Speed * dt.asSeconds();
+        m_Position.x += m_DirectionX * m_Speed * dt;
     }
 
     // Ensuring the positions aren't out of bounds
@@ -177,68 +153,33 @@ Vector2f Centipede::update(Time dt)
     }
 
     // Actually move the centipede
-    m_Shape.setPosition(m_Position);
-    m_HeadSprite.setPosition(m_Position + m_Offset);
-    m_BodySprite.setPosition(m_Position);
-
-    // Returning the previous movement made by the centipede to set the next particle to it
-    Vector2f temp = m_PrevMove;
-    m_PrevMove = m_Position - m_PrevPosition;
-    return temp;
+    m_Bounds.setPosition(m_Position);
 }
 
-Vector2f Centipede::update(Time dt, Vector2f aheadPosition)
+void Centipede::follow(Vec2 position)
 {
-    //if type is head, do normal update. Otherwise, use the ahead position vector
-    if (m_Type == HEAD)
-    {
-        return update(dt);
-    }
+    //saving where the update started
+    m_TickStartPosition = Vec2(m_Bounds.left, m_Bounds.top);
 
-    //simply moving by the ahead body's previous movement
-    m_Position = m_Position + aheadPosition;
-  
-    // Move the centipede
-    m_Shape.setPosition(m_Position);
-    m_HeadSprite.setPosition(m_Position + m_Offset);
-    m_BodySprite.setPosition(m_Position);
-
-    // Return the previous position to set the next particle to it
-    Vector2f temp(m_PrevMove);
-    m_PrevMove = m_Position - m_PrevPosition;
-    m_PrevPosition = m_Position;
-    return temp;
-}
-
-void Centipede::draw()
-{
-    //based on the type of the segment, draw it differently
-    if (m_Type == BODY || m_Type == TAIL)
-    {
-	    //just draw the body type, orientation doesn't matter
-	    m_Window -> draw(m_BodySprite);
+    //taking the directions from the movement along the path
+    Vec2 move = position - m_Position;
+    if (std::abs(move.x) > std::abs(move.y))
+    { //moving left/right
+        m_Bounce = false;
+        m_DirectionX = (move.x < 0) ? -1 : 1;
+        m_DirectionY = (m_DirectionY < 0) ? -2 : 2;
     }
-    else
-    { //based on the orientation of the head, draw the sprite
-	    if (m_DirectionY == -1)
-	    { //point the head upwards
-	        m_HeadSprite.setRotation(270.0f);
-	        m_Window -> draw(m_HeadSprite);
-	    }
-	    else if (m_DirectionY == 1)
-	    { //point the head downwards
-	        m_HeadSprite.setRotation(90.0f);
-	        m_Window -> draw(m_HeadSprite);
-	    }
-	    else if (m_DirectionX == 1)
-	    { //point the head right
-	        m_HeadSprite.setRotation(.0f);
-	        m_Window -> draw(m_HeadSprite);
-	    }
-	    else
-	    { //point the head left
-	        m_HeadSprite.setRotation(180.0f);
-	        m_Window -> draw(m_HeadSprite);
-	    }
+    else if (move.y != 0)
+    { //moving up/down, heading for the row above/below where the turn started
+        if (std::abs(m_DirectionY) == 2 || (move.y < 0) != (m_DirectionY < 0))
+        {
+            m_Distance = (move.y < 0) ? m_Position.y - 35 : m_Position.y + 35;
+        }
+        m_Bounce = true;
+        m_DirectionY = (move.y < 0) ? -1 : 1;
     }
-}
\ No newline at end of file
+
+    //moving to the spot on the path
+    m_Position = position;
+    m_Bounds.setPosition(m_Position);
+}
@@ -0,0 +1,192 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the centipede class to:
+ - Calculate current location and movement information for this specific segment of the centipede
+ - Detect collisions between objects to do damage / change movement
+ - Hold the type of centipede body part (head, end, middle)
+ - Follow the path its head left behind (only heads steer themselves)
+*/
+
+#pragma once
+#include "Geometry.h"
+#include "Random.h"
+#include <type_traits>
+
+    // Public global types defined for class
+    enum BodyType {
+	    HEAD = 0,
+	    BODY = 1,
+	    TAIL = 2
+	};
+
+class Centipede
+{
+private:
+    // Creating necessary objects for the location/shape
+    Vec2 m_Position;
+    Bounds m_Bounds;
+    Vec2 m_TickStartPosition; //where the segment was drawn before the last update
+
+    // Setting values for the object
+    static constexpr float m_Width = 35;
+    static constexpr float m_Height = 35;
+
+    static constexpr float m_Speed = 8 * 80.0f;
+    bool m_Bounce = false;
+
+    static constexpr int m_Damage = 1;
+
+    int m_DirectionX; //identifies left vs right movement
+    int m_DirectionY; //only used when going up/down to orient head
+    float m_Distance; //used to ensure centipede is only moved 35 up/down
+
+    int m_Points = 0; //variable depending on head or body //10 points per body, 100 per head
+
+    BodyType m_Type; //identifies the type of this part of the centipede.
+  
+    //creating screen values
+    float m_ScreenWidth;
+    float m_ScreenHeight;
+    float m_MaxHeight;
+
+public:
+    /**
+     * Constructor for the Centipede class to create the current centipede segment object.
+     * 
+     * Parameters:
+     * @param screenWidth - the logical width of the playing field the centipede moves within
+     * @param screenHeight - the logical height of the playing field the centipede moves within
+     * @param type - the type of the current centipede object (HEAD, BODY, or TAIL)
+     * @param numSegment - the segment number of the current segment to ensure it is evently spaced
+     * @param headRandom - pointer to a float to write to if the current segment is the head to have all segments go in the same random direction at first
+     * @param generator - the world's random generator to pick the head's starting direction with
+     */
+    Centipede(float screenWidth, float screenHeight, BodyType type, int numSegment, float* headRandom, Random& generator);
+
+
+  
+    // Location and shape methods
+
+    /**
+     * Function to simply return the bounds (position and shape) of the object.
+     * 
+     * Returns:
+     * @return reference to the rectangle bounds of the object (kept up to date only when it moves)
+     */
+    const Bounds& getPosition() const { return m_Bounds; }
+
+    /**
+     * Function to get where to draw the object between its last two updates so motion stays smooth at any refresh rate.
+     * 
+     * Parameters:
+     * @param alpha - how far between the previous update (0) and the latest update (1) to draw the object
+     *
+     * Returns:
+     * @return top left position to draw the object at
+     */
+    Vec2 getInterpolatedPosition(float alpha) const;
+
+    /**
+     * Function to simply get how far the object moved during its last update.
+     *
+     * Returns:
+     * @return the movement from the start to the end of the last update
+     */
+    Vec2 getMovement() const { return Vec2(m_Bounds.left, m_Bounds.top) - m_TickStartPosition; }
+
+    /**
+     * Function to get the area the object covered during its last update (for looking up what it may have passed through).
+     *
+     * Returns:
+     * @return the bounds box around the object's whole last movement
+     */
+    Bounds getSweptPosition() const;
+
+  
+
+    // Specific methods
+	
+    /**
+     * Function to simply get the number of points the centipede segment is worth, variable to the type:
+     *   HEAD = 100 points
+     *   BODY/TAIL = 10 points
+     * 
+     * Returns:
+     * @return the amount of points the centipede is worth
+     */
+    int getPoints() const { return m_Points; }
+
+    /**
+     * Function to simply get the current type of the segment.
+     * 
+     * Returns:
+     * @return the current BodyType of the centipede segment
+     */
+    BodyType getType() const { return m_Type; }
+    
+    /**
+     * Function to simply set the type of the segment.
+     * 
+     * Parameters:
+     * @param type - the new BodyType of the centipede segment
+     */
+    void setType(BodyType type);
+
+    /**
+     * Function to simply get the left/right movement direction of the segment (used to orient the head).
+     * 
+     * Returns:
+     * @return -1 for moving left, 1 for moving right
+     */
+    int getDirectionX() const { return m_DirectionX; }
+
+    /**
+     * Function to simply get the up/down movement direction of the segment (used to orient the head).
+     * 
+     * Returns:
+     * @return -1/1 while moving up/down, -2/2 while moving sideways on an upward/downward path
+     */
+    int getDirectionY() const { return m_DirectionY; }
+
+
+  
+    // Collision and Update methods
+
+    /**
+     * Function to check collisions and do damage if there was a collision.
+     *  Simply takes in an object bounds and sees if it intersects with the current object.
+     *  If the object is hit, do the specified amount of damage.
+     * 
+     * Parameters:
+     * @param other - bounds box of the other object to check for collision
+     * @param damage - amount of damage to do to object upon collision
+     *
+     * Returns:
+     * @return value of how much damage to do to the other object (-1 means no collision occured)
+     */
+    int checkDamage(Bounds other, int damage);
+
+    /**
+     * Function to update the positions and values of a centipede head based on movment direction and timing.
+     * 
+     * Parameters:
+     * @param dt - how long it has been (in seconds) since the last update to move the object accordingly far
+     */
+    void update(float dt);
+
+    /**
+     * Function to move a follower to its spot on its head's path.
+     *  The movement also sets the segment's directions, so it steers the right way if it ever becomes a head.
+     * 
+     * Parameters:
+     * @param position - top left position on the head's path to move to
+     */
+    void follow(Vec2 position);
+};
+
+//keeping the centipede small and plain to copy (every live segment is packed in the slot map and moved whenever one is shot)
+static_assert(sizeof(Centipede) <= 72, "Centipede grew past its size budget");
+static_assert(std::is_trivially_copyable<Centipede>::value, "Centipede must stay trivially copyable");
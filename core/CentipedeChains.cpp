@@ -0,0 +1,151 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the program file which implements the centipede chains class to:
+ - Hold every segment of the round's centipede, and which of them are still joined up into chains (each led by its own head)
+ - Update each chain as a unit: the head steers and records its path, the rest of the chain follows along that path
+ - Shoot segments out in constant time, shortening a chain or splitting it into two independent chains
+*/
+
+#include "CentipedeChains.h"
+#include <algorithm>
+
+void CentipedeChains::clear()
+{
+    m_Segments.clear();
+    m_Order.clear();
+    m_ChainCount = 0;
+}
+
+void CentipedeChains::spawn(float screenWidth, float screenHeight, int count, Random& generator)
+{
+    //creating the head segment first, the tail segment last, and the body segments in between
+    clear();
+    float headRandom; //temporary float to identify which random direction the head moves in originally
+    for (int i = 0; i < count; ++i)
+    {
+        BodyType type = (i == 0) ? HEAD : ((i == count - 1) ? TAIL : BODY);
+        m_Order.push_back(m_Segments.add(Centipede(screenWidth, screenHeight, type, i, &headRandom, generator)));
+    }
+
+    //starting the head's path as the line the segments are lined up on, so each one already sits at its spot along it
+    Chain& chain = m_Chains[addChain(0)];
+    chain.first = 0;
+    chain.last = count - 1;
+    chain.path.clear();
+    chain.path.setReach((count - 1) * m_Spacing);
+    Bounds tail = m_Segments.getLive(m_Order[chain.last]).getPosition();
+    Bounds head = m_Segments.getLive(m_Order[chain.first]).getPosition();
+    chain.path.push(Vec2(tail.left, tail.top));
+    chain.path.push(Vec2(head.left, head.top));
+}
+
+int CentipedeChains::addChain(int index)
+{
+    //making a new spare only if every chain made so far is in use
+    if (m_ChainCount == (int) m_Chains.size())
+    {
+        m_Chains.emplace_back();
+    }
+
+    //moving the first spare into place (the chains swap places, no path memory is copied)
+    std::rotate(m_Chains.begin() + index, m_Chains.begin() + m_ChainCount, m_Chains.begin() + m_ChainCount + 1);
+    m_ChainCount++;
+    return index;
+}
+
+void CentipedeChains::removeChain(int index)
+{
+    //moving the chain to the front of the spares
+    std::rotate(m_Chains.begin() + index, m_Chains.begin() + index + 1, m_Chains.begin() + m_ChainCount);
+    m_ChainCount--;
+}
+
+int CentipedeChains::findChain(int order) const
+{
+    //finding the last chain starting at or before the segment
+    std::vector<Chain>::const_iterator chain = std::upper_bound(m_Chains.begin(), m_Chains.begin() + m_ChainCount, order,
+        [](int order, const Chain& chain) { return order < chain.first; });
+    return (int) (chain - m_Chains.begin()) - 1;
+}
+
+void CentipedeChains::update(float dt)
+{
+    //moving each head and recording it on its path, then placing every segment behind it a spacing further back along that path
+    //a follower's spot only depends on its head's path, never on the segment ahead of it
+    for (int c = 0; c < m_ChainCount; ++c)
+    {
+        Chain& chain = m_Chains[c];
+        Centipede& head = m_Segments.getLive(m_Order[chain.first]);
+        head.update(dt);
+        chain.path.push(Vec2(head.getPosition().left, head.getPosition().top));
+
+        int cursor = -1; //where on the path the last follower was found, the next one is found searching back from there
+        for (int j = chain.first + 1; j <= chain.last; ++j)
+        {
+            m_Segments.getLive(m_Order[j]).follow(chain.path.sample((j - chain.first) * m_Spacing, cursor));
+        }
+    }
+}
+
+bool CentipedeChains::destroy(int order)
+{
+    //ensuring the segment wasn't already shot
+    if (!m_Segments.contains(m_Order[order]))
+    {
+        return false;
+    }
+    int c = findChain(order);
+    Chain& chain = m_Chains[c];
+
+    /*  Based on where the segment is in its chain, change the chain around it
+        a) If it is the whole chain, the chain is gone
+        b) If it is the head, the next segment takes over the path from its own spot on it, one spacing back
+        c) If it is the tail, the previous segment becomes the tail
+        d) Otherwise, the back part of the chain becomes a new chain with its own head and path
+    */
+    if (chain.first == chain.last)
+    {
+        removeChain(c);
+    }
+    else if (order == chain.first)
+    {
+        chain.first++;
+        chain.path.cutNewest(m_Spacing);
+        chain.path.setReach((chain.last - chain.first) * m_Spacing);
+        m_Segments.getLive(m_Order[chain.first]).setType(HEAD);
+    }
+    else if (order == chain.last)
+    {
+        chain.last--;
+        chain.path.setReach((chain.last - chain.first) * m_Spacing);
+        if (chain.last != chain.first)
+        {
+            m_Segments.getLive(m_Order[chain.last]).setType(TAIL);
+        }
+    }
+    else
+    {
+        //the new chain goes right behind the old one and copies the path from its head's spot back as far as its followers reach
+        Chain& back = m_Chains[addChain(c + 1)];
+        Chain& front = m_Chains[c];
+        back.first = order + 1;
+        back.last = front.last;
+        back.path.copyBehind(front.path, (back.first - front.first) * m_Spacing, (back.last - back.first) * m_Spacing);
+        m_Segments.getLive(m_Order[back.first]).setType(HEAD);
+
+        //the old chain now ends at the segment ahead of this one
+        front.last = order - 1;
+        front.path.setReach((front.last - front.first) * m_Spacing);
+        if (front.last != front.first)
+        {
+            m_Segments.getLive(m_Order[front.last]).setType(TAIL);
+        }
+    }
+
+    //removing the segment (the last segment moves into its place)
+    m_Segments.remove(m_Order[order]);
+    return true;
+}
@@ -0,0 +1,151 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the centipede chains class to:
+ - Hold every segment of the round's centipede, and which of them are still joined up into chains (each led by its own head)
+ - Update each chain as a unit: the head steers and records its path, the rest of the chain follows along that path
+ - Shoot segments out in constant time, shortening a chain or splitting it into two independent chains
+*/
+
+#pragma once
+#include "Centipede.h"
+#include "PathHistory.h"
+#include "SlotMap.h"
+#include "Random.h"
+#include <vector>
+
+class CentipedeChains
+{
+private:
+    //one centipede: a run of segments in the round's order, led by the first one
+    struct Chain
+    {
+        int first; //order of the head
+        int last; //order of the tail
+        PathHistory path; //where the head has been, followed by the rest of the chain
+    };
+
+    //setting constant values for the chains
+    static constexpr float m_Spacing = 35; //how far apart the segments are along their head's path (one segment wide)
+
+    //creating the segment and chain lists
+    SlotMap<Centipede> m_Segments; //every segment still alive, packed in no particular order
+    std::vector<SlotHandle> m_Order; //every segment the round started with, front to back (never reordered, shot segments' handles go stale)
+    std::vector<Chain> m_Chains; //the chains in use first, sorted by their first order (the chains never overlap)
+    int m_ChainCount = 0; //how many chains are in use (the ones after them are spares, keeping their path memory for later splits and rounds)
+
+    /**
+     * Private function to find the chain a live segment is in.
+     *
+     * Parameters:
+     * @param order - the order of the segment
+     *
+     * Returns:
+     * @return the index of its chain
+     */
+    int findChain(int order) const;
+
+    /**
+     * Private function to put a chain in use at a place in the chain list, reusing a spare chain if there is one.
+     *
+     * Parameters:
+     * @param index - where in the list of chains in use to put it (the chains from there on move back one)
+     *
+     * Returns:
+     * @return the index of the chain (its old path is still there to be cleared or copied over)
+     */
+    int addChain(int index);
+
+    /**
+     * Private function to stop using a chain, keeping it (and its path memory) as a spare.
+     *
+     * Parameters:
+     * @param index - which chain in use to remove (the chains after it move forward one)
+     */
+    void removeChain(int index);
+
+public:
+    /**
+     * Function to remove every segment and chain (keeps the memory, so the next round doesn't allocate any).
+     */
+    void clear();
+
+    /**
+     * Function to start a round's centipede as one chain lined up off the side of the screen.
+     *
+     * Parameters:
+     * @param screenWidth - the logical width of the playing field the centipede moves within
+     * @param screenHeight - the logical height of the playing field the centipede moves within
+     * @param count - how many segments long the centipede is (at least 2, a head and a tail)
+     * @param generator - the world's random generator to pick the head's starting direction with
+     */
+    void spawn(float screenWidth, float screenHeight, int count, Random& generator);
+
+    /**
+     * Function to update every chain: each head moves and records its path, then the rest of its chain is placed along it.
+     *
+     * Parameters:
+     * @param dt - how long it has been (in seconds) since the last update to move the segments accordingly far
+     */
+    void update(float dt);
+
+    /**
+     * Function to shoot a segment out of its chain. A head is replaced by the segment behind it, a tail by the one ahead of it,
+     *  and a segment in the middle splits its chain in two (the back part becomes a new chain with its own head and path).
+     *
+     * Parameters:
+     * @param order - the order of the segment
+     *
+     * Returns:
+     * @return whether the segment was removed (false if it was already shot)
+     */
+    bool destroy(int order);
+
+    /**
+     * Function to get every segment still alive
+     *
+     * Returns:
+     * @return reference to the slot map of segments (packed in no particular order)
+     */
+    SlotMap<Centipede>& getSegments() { return m_Segments; }
+
+    /**
+     * Function to simply get how many segments the round started with (every order is below this)
+     *
+     * Returns:
+     * @return the number of segments the round started with
+     */
+    int getOrderCount() const { return (int) m_Order.size(); }
+
+    /**
+     * Function to get a segment by its order (its place in the round's centipede, front to back).
+     *
+     * Parameters:
+     * @param order - the order of the segment
+     *
+     * Returns:
+     * @return pointer to the segment (valid until the next segment is shot), or nullptr if it was shot
+     */
+    Centipede* getSegment(int order) { return m_Segments.get(m_Order[order]); }
+
+    /**
+     * Function to simply get how many chains there are
+     *
+     * Returns:
+     * @return the number of chains
+     */
+    int getChainCount() const { return m_ChainCount; }
+
+    /**
+     * Function to get the head of a chain
+     *
+     * Parameters:
+     * @param chain - which chain (0 is the one furthest forward in the round's order)
+     *
+     * Returns:
+     * @return reference to the head segment
+     */
+    Centipede& getHead(int chain) { return m_Segments.getLive(m_Order[m_Chains[chain].first]); }
+};
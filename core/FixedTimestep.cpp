@@ -0,0 +1,66 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the program file which implements the fixed timestep class to:
+ - Collect the variable real time between frames and turn it into fixed length simulation ticks
+ - Limit how many catch-up ticks can run in one frame so a long hitch can't snowball
+ - Give the fraction of a tick left over so drawing can interpolate between the last two ticks
+*/
+
+#include "FixedTimestep.h"
+
+FixedTimestep::FixedTimestep(float tickRate, int maxTicksPerFrame)
+{
+    //saving the tick values
+    m_TickLength = 1.0f / tickRate;
+    m_MaxTicksPerFrame = maxTicksPerFrame;
+}
+
+void FixedTimestep::addFrameTime(float seconds)
+{
+    //adding the frame's time to what still needs to be simulated
+    m_Accumulator += seconds;
+    m_TicksThisFrame = 0;
+}
+
+bool FixedTimestep::nextTick()
+{
+    //not enough time saved up for another tick
+    if (m_Accumulator < m_TickLength)
+    {
+        return false;
+    }
+
+    //already caught up as much as allowed this frame, drop the rest so it doesn't keep growing
+    if (m_TicksThisFrame >= m_MaxTicksPerFrame)
+    {
+        m_Accumulator = 0;
+        return false;
+    }
+
+    //use up one tick of time
+    m_Accumulator -= m_TickLength;
+    m_TicksThisFrame++;
+    return true;
+}
+
+void FixedTimestep::reset()
+{
+    //dropping the time that hasn't been simulated
+    m_Accumulator = 0;
+    m_TicksThisFrame = 0;
+}
+
+float FixedTimestep::getTickLength()
+{
+    //returning the tick length
+    return m_TickLength;
+}
+
+float FixedTimestep::getAlpha()
+{
+    //returning how far into the next tick the real time is
+    return m_Accumulator / m_TickLength;
+}
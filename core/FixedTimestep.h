@@ -0,0 +1,73 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the fixed timestep class to:
+ - Collect the variable real time between frames and turn it into fixed length simulation ticks
+ - Limit how many catch-up ticks can run in one frame so a long hitch can't snowball
+ - Give the fraction of a tick left over so drawing can interpolate between the last two ticks
+*/
+
+#pragma once
+
+class FixedTimestep
+{
+private:
+    //setting constant values for the timestep
+    float m_TickLength; //length of one simulation tick in seconds
+    int m_MaxTicksPerFrame; //most catch-up ticks allowed in one frame
+
+    //creating changing values for the timestep
+    float m_Accumulator = 0; //real time that hasn't been simulated yet
+    int m_TicksThisFrame = 0; //ticks already run since the last frame was added
+
+public:
+    /**
+     * Constructor for the FixedTimestep class.
+     *
+     * Parameters:
+     * @param tickRate - how many simulation ticks to run per second
+     * @param maxTicksPerFrame - the most ticks to run for one frame (extra time is dropped)
+     */
+    FixedTimestep(float tickRate = 120.0f, int maxTicksPerFrame = 8);
+
+    /**
+     * Function to add the real time that passed during the last frame.
+     *
+     * Parameters:
+     * @param seconds - how long the last frame took
+     */
+    void addFrameTime(float seconds);
+
+    /**
+     * Function to check if another tick needs to run for the current frame, and use up its time if so.
+     *  Meant to be used as the condition of a loop that steps the world once per tick.
+     *
+     * Returns:
+     * @return whether a tick should be run
+     */
+    bool nextTick();
+
+    /**
+     * Function to drop any time that hasn't been simulated yet (e.g. after a new round starts).
+     */
+    void reset();
+
+    /**
+     * Function to simply get the length of one tick
+     *
+     * Returns:
+     * @return the tick length in seconds
+     */
+    float getTickLength();
+
+    /**
+     * Function to get how far the real time is between the last tick and the next one.
+     *  Drawing at (previous tick position + alpha * movement) keeps motion smooth at any refresh rate.
+     *
+     * Returns:
+     * @return the interpolation factor from 0 (last tick) to 1 (next tick)
+     */
+    float getAlpha();
+};
@@ -0,0 +1,188 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the basic geometry types of the simulation core to:
+ - Hold positions and movement vectors without needing SFML or a window
+ - Hold the bounds box of an object and check it for collisions with other bounds boxes
+ - Sweep a moving bounds box along its movement to find when it first hits another one (so fast objects can't skip over things)
+*/
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+struct Vec2
+{
+    float x = 0;
+    float y = 0;
+
+    Vec2() = default;
+    Vec2(float X, float Y) : x(X), y(Y) {}
+
+    Vec2 operator+(const Vec2& other) const { return Vec2(x + other.x, y + other.y); }
+    Vec2 operator-(const Vec2& other) const { return Vec2(x - other.x, y - other.y); }
+
+    /**
+     * Function to find the point part of the way between two positions.
+     *
+     * Parameters:
+     * @param from - the starting position
+     * @param to - the ending position
+     * @param alpha - how far along to go (0 is from, 1 is to)
+     *
+     * Returns:
+     * @return the in between position
+     */
+    static Vec2 lerp(Vec2 from, Vec2 to, float alpha)
+    {
+        return Vec2(from.x + (to.x - from.x) * alpha, from.y + (to.y - from.y) * alpha);
+    }
+};
+
+struct Bounds
+{
+    float left = 0;
+    float top = 0;
+    float width = 0;
+    float height = 0;
+
+    Bounds() = default;
+    Bounds(float Left, float Top, float Width, float Height) : left(Left), top(Top), width(Width), height(Height) {}
+
+    /**
+     * Function to move the bounds box so its top left corner is at the given position.
+     *
+     * Parameters:
+     * @param position - the new top left corner of the bounds box
+     */
+    void setPosition(Vec2 position)
+    {
+        left = position.x;
+        top = position.y;
+    }
+
+    /**
+     * Function to check if two bounds boxes overlap (touching edges do not count as a collision).
+     *
+     * Parameters:
+     * @param other - the other bounds box to check against
+     * @param intersection - written with the overlapping area of the two boxes if they intersect
+     *
+     * Returns:
+     * @return whether the two bounds boxes intersect
+     */
+    bool intersects(const Bounds& other, Bounds& intersection) const
+    {
+        //finding the overlapping area of both boxes
+        float interLeft   = std::max(left, other.left);
+        float interTop    = std::max(top, other.top);
+        float interRight  = std::min(left + width, other.left + other.width);
+        float interBottom = std::min(top + height, other.top + other.height);
+
+        //only a collision if the overlap has an actual area
+        if (interLeft < interRight && interTop < interBottom)
+        {
+            intersection = Bounds(interLeft, interTop, interRight - interLeft, interBottom - interTop);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Function to check if two bounds boxes overlap (touching edges do not count as a collision).
+     *
+     * Parameters:
+     * @param other - the other bounds box to check against
+     *
+     * Returns:
+     * @return whether the two bounds boxes intersect
+     */
+    bool intersects(const Bounds& other) const
+    {
+        Bounds intersection;
+        return intersects(other, intersection);
+    }
+
+    /**
+     * Function to find the area a bounds box covers while moving (both end boxes and everything between them).
+     *
+     * Parameters:
+     * @param movement - how far the box moves from where it is now
+     *
+     * Returns:
+     * @return the bounds box around the whole movement
+     */
+    Bounds sweptArea(Vec2 movement) const
+    {
+        float sweptLeft = std::min(left, left + movement.x);
+        float sweptTop  = std::min(top, top + movement.y);
+        return Bounds(sweptLeft, sweptTop, width + std::abs(movement.x), height + std::abs(movement.y));
+    }
+
+    /**
+     * Function to find when a moving bounds box first overlaps a still one during its movement (touching edges do not count).
+     *
+     * Parameters:
+     * @param movement - how far this box moves from where it is now
+     * @param other - the still bounds box to check against
+     * @param time - written with how far along the movement the boxes first overlap (0 is the start, 1 is the end)
+     *
+     * Returns:
+     * @return whether the boxes overlap at any point of the movement
+     */
+    bool sweep(Vec2 movement, const Bounds& other, float& time) const
+    {
+        //finding the part of the movement where the boxes overlap on each axis, then where both overlap at once
+        float enter = -std::numeric_limits<float>::infinity();
+        float exit = std::numeric_limits<float>::infinity();
+        if (!sweepAxis(left, width, movement.x, other.left, other.width, enter, exit) ||
+            !sweepAxis(top, height, movement.y, other.top, other.height, enter, exit))
+        {
+            return false;
+        }
+
+        //only a collision if the overlap has an actual length and happens during this movement
+        if (enter < exit && enter < 1 && exit > 0)
+        {
+            time = std::max(enter, 0.0f);
+            return true;
+        }
+        return false;
+    }
+
+private:
+    /**
+     * Private function to narrow the part of a movement where two boxes overlap down to where they also overlap on one axis.
+     *
+     * Parameters:
+     * @param start - where this box starts on the axis
+     * @param size - the size of this box on the axis
+     * @param movement - how far this box moves on the axis
+     * @param otherStart - where the other box is on the axis
+     * @param otherSize - the size of the other box on the axis
+     * @param enter - the latest time the boxes started overlapping so far (pushed later by this axis)
+     * @param exit - the earliest time the boxes stopped overlapping so far (pulled earlier by this axis)
+     *
+     * Returns:
+     * @return false if the boxes never overlap on this axis
+     */
+    static bool sweepAxis(float start, float size, float movement, float otherStart, float otherSize, float& enter, float& exit)
+    {
+        if (movement == 0)
+        { //not moving on this axis, the boxes either always or never overlap on it
+            return start < otherStart + otherSize && otherStart < start + size;
+        }
+        float axisEnter = (otherStart - (start + size)) / movement;
+        float axisExit  = (otherStart + otherSize - start) / movement;
+        if (axisEnter > axisExit)
+        { //moving backwards along the axis
+            std::swap(axisEnter, axisExit);
+        }
+        enter = std::max(enter, axisEnter);
+        exit  = std::min(exit, axisExit);
+        return true;
+    }
+};
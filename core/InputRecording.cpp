@@ -0,0 +1,248 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the program file which implements the input recording classes to:
+ - Record the player's per-tick action bitmask of every match (with the match's seed) into a compact file
+ - Read a recording back so the exact same matches can be replayed without a window or frame pacing
+*/
+
+#include "InputRecording.h"
+#include <algorithm>
+#include <iterator>
+
+// Format constants shared by the recorder and the playback
+static const char RECORDING_MAGIC[4] = { 'C', 'P', 'R', 'C' };
+static const uint8_t RECORDING_VERSION = 1;
+
+/**
+ * Function to add an unsigned LEB128 varint (7 bits per byte, high bit set while more bytes follow) to a buffer.
+ *
+ * Parameters:
+ * @param buffer - the buffer to add the bytes to
+ * @param value - the value to write
+ */
+static void writeVarint(std::vector<uint8_t>& buffer, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        buffer.push_back((uint8_t) (value | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back((uint8_t) value);
+}
+
+
+
+// Recorder
+
+InputRecorder::~InputRecorder()
+{
+    close();
+}
+
+bool InputRecorder::open(const std::string& path, float width, float height, float tickRate)
+{
+    //creating the file
+    m_File.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_File.is_open())
+    {
+        return false;
+    }
+
+    //writing the header with the world settings
+    std::vector<uint8_t> header(RECORDING_MAGIC, RECORDING_MAGIC + 4);
+    header.push_back(RECORDING_VERSION);
+    writeVarint(header, (uint64_t) width);
+    writeVarint(header, (uint64_t) height);
+    writeVarint(header, (uint64_t) (tickRate + 0.5f)); //rounded so 1 / (1 / 120) doesn't become 119
+    m_File.write((const char*) header.data(), header.size());
+    return m_File.good();
+}
+
+void InputRecorder::beginMatch(uint64_t seed)
+{
+    //finishing any match that wasn't ended
+    if (m_InMatch)
+    {
+        endMatch();
+    }
+
+    //starting the match with its seed
+    m_Buffer.clear();
+    writeVarint(m_Buffer, seed);
+    m_RunLength = 0;
+    m_InMatch = true;
+}
+
+void InputRecorder::flushRun()
+{
+    //writing out the run of identical inputs (if there is one)
+    if (m_RunLength > 0)
+    {
+        writeVarint(m_Buffer, m_RunLength);
+        m_Buffer.push_back(m_RunInput);
+        m_RunLength = 0;
+    }
+}
+
+void InputRecorder::record(Input input)
+{
+    //ignoring inputs outside of a match
+    if (!m_InMatch)
+    {
+        return;
+    }
+
+    //extending the current run if the input didn't change, otherwise starting a new one
+    if (m_RunLength > 0 && input != m_RunInput)
+    {
+        flushRun();
+    }
+    m_RunInput = input;
+    m_RunLength++;
+}
+
+void InputRecorder::endMatch()
+{
+    //ignoring if no match was started
+    if (!m_InMatch)
+    {
+        return;
+    }
+
+    //ending the match with a run of 0 and writing it to the file
+    flushRun();
+    writeVarint(m_Buffer, 0);
+    if (m_File.is_open())
+    {
+        m_File.write((const char*) m_Buffer.data(), m_Buffer.size());
+        m_File.flush();
+    }
+    m_Buffer.clear();
+    m_InMatch = false;
+}
+
+void InputRecorder::close()
+{
+    //finishing the match and closing the file
+    endMatch();
+    if (m_File.is_open())
+    {
+        m_File.close();
+    }
+}
+
+
+
+// Playback
+
+bool InputPlayback::readVarint(uint64_t& value)
+{
+    //reading 7 bits at a time until a byte without the high bit
+    value = 0;
+    for (int shift = 0; m_Offset < m_Data.size() && shift < 64; shift += 7)
+    {
+        uint8_t byte = m_Data[m_Offset++];
+        value |= (uint64_t) (byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool InputPlayback::open(const std::string& path)
+{
+    //reading the whole file
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+    m_Data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    m_Offset = 0;
+    m_InMatch = false;
+
+    //checking the header
+    if (m_Data.size() < 5 || !std::equal(RECORDING_MAGIC, RECORDING_MAGIC + 4, m_Data.begin()) || m_Data[4] != RECORDING_VERSION)
+    {
+        return false;
+    }
+    m_Offset = 5;
+
+    //reading the world settings
+    uint64_t width, height, tickRate;
+    if (!readVarint(width) || !readVarint(height) || !readVarint(tickRate))
+    {
+        return false;
+    }
+    m_Width = (float) width;
+    m_Height = (float) height;
+    m_TickRate = (float) tickRate;
+    return true;
+}
+
+float InputPlayback::getWidth()
+{
+    return m_Width;
+}
+
+float InputPlayback::getHeight()
+{
+    return m_Height;
+}
+
+float InputPlayback::getTickRate()
+{
+    return m_TickRate;
+}
+
+bool InputPlayback::nextMatch(uint64_t& seed)
+{
+    //skipping whatever is left of the current match (a whole run at a time)
+    while (m_InMatch)
+    {
+        Input input;
+        m_RunLeft = 0;
+        nextInput(input);
+    }
+
+    //reading the seed of the next match
+    if (!readVarint(seed))
+    {
+        return false;
+    }
+    m_RunLeft = 0;
+    m_InMatch = true;
+    return true;
+}
+
+bool InputPlayback::nextInput(Input& input)
+{
+    //no match is being played
+    if (!m_InMatch)
+    {
+        return false;
+    }
+
+    //starting the next run once the current one is used up
+    if (m_RunLeft == 0)
+    {
+        uint64_t length;
+        if (!readVarint(length) || length == 0 || m_Offset >= m_Data.size())
+        { //end of the match (or the file was cut short)
+            m_InMatch = false;
+            return false;
+        }
+        m_RunLeft = length;
+        m_RunInput = m_Data[m_Offset++];
+    }
+
+    //using up one tick of the run
+    m_RunLeft--;
+    input = m_RunInput;
+    return true;
+}
@@ -0,0 +1,170 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the input recording classes to:
+ - Record the player's per-tick action bitmask of every match (with the match's seed) into a compact file
+ - Read a recording back so the exact same matches can be replayed without a window or frame pacing
+
+File layout (all numbers are unsigned LEB128 varints unless noted):
+ - "CPRC" magic (4 bytes), format version (1 byte), world width, world height, ticks per second
+ - then for every match: seed, then runs of (tick count, action bitmask byte), ended by a tick count of 0
+*/
+
+#pragma once
+#include "World.h"
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+class InputRecorder
+{
+private:
+    //creating necessary objects for writing
+    std::ofstream m_File;
+    std::vector<uint8_t> m_Buffer; //bytes of the current match, written out when the match ends
+
+    //creating changing values for the current run of identical inputs
+    Input m_RunInput = 0;
+    uint64_t m_RunLength = 0;
+    bool m_InMatch = false;
+
+    /**
+     * Private function to add the current run of identical inputs to the buffer.
+     */
+    void flushRun();
+
+public:
+    /**
+     * Destructor for the InputRecorder class which finishes any match being recorded and closes the file.
+     */
+    ~InputRecorder();
+
+    /**
+     * Function to create the recording file and write the world settings to it.
+     *
+     * Parameters:
+     * @param path - where to write the recording
+     * @param width - the logical width of the recorded world
+     * @param height - the logical height of the recorded world
+     * @param tickRate - how many ticks per second the world is stepped at
+     *
+     * Returns:
+     * @return whether the file could be created
+     */
+    bool open(const std::string& path, float width, float height, float tickRate);
+
+    /**
+     * Function to start recording a new match.
+     *
+     * Parameters:
+     * @param seed - the seed the world was given right before the match began
+     */
+    void beginMatch(uint64_t seed);
+
+    /**
+     * Function to record the input of one tick of the current match.
+     *
+     * Parameters:
+     * @param input - the action bitmask the world was stepped with
+     */
+    void record(Input input);
+
+    /**
+     * Function to finish the current match and write it to the file.
+     */
+    void endMatch();
+
+    /**
+     * Function to finish any match being recorded and close the file.
+     */
+    void close();
+};
+
+class InputPlayback
+{
+private:
+    //creating the recording values
+    std::vector<uint8_t> m_Data; //the whole file (recordings are small)
+    size_t m_Offset = 0;
+
+    float m_Width = 0;
+    float m_Height = 0;
+    float m_TickRate = 0;
+
+    //creating changing values for the current run of identical inputs
+    Input m_RunInput = 0;
+    uint64_t m_RunLeft = 0;
+    bool m_InMatch = false;
+
+    /**
+     * Private function to read the next varint from the file data.
+     *
+     * Parameters:
+     * @param value - written with the value that was read
+     *
+     * Returns:
+     * @return whether a full value could be read
+     */
+    bool readVarint(uint64_t& value);
+
+public:
+    /**
+     * Function to read a recording file and its world settings.
+     *
+     * Parameters:
+     * @param path - the recording to read
+     *
+     * Returns:
+     * @return whether the file could be read and is a recording
+     */
+    bool open(const std::string& path);
+
+    /**
+     * Function to simply get the logical width of the recorded world
+     *
+     * Returns:
+     * @return the width of the world
+     */
+    float getWidth();
+
+    /**
+     * Function to simply get the logical height of the recorded world
+     *
+     * Returns:
+     * @return the height of the world
+     */
+    float getHeight();
+
+    /**
+     * Function to simply get how many ticks per second the recorded world was stepped at
+     *
+     * Returns:
+     * @return the tick rate
+     */
+    float getTickRate();
+
+    /**
+     * Function to move to the next recorded match (skipping whatever is left of the current one).
+     *
+     * Parameters:
+     * @param seed - written with the seed the match was played with
+     *
+     * Returns:
+     * @return whether there was another match
+     */
+    bool nextMatch(uint64_t& seed);
+
+    /**
+     * Function to get the input of the next tick of the current match.
+     *
+     * Parameters:
+     * @param input - written with the action bitmask of the tick
+     *
+     * Returns:
+     * @return whether there was another tick in the match
+     */
+    bool nextInput(Input& input);
+};
@@ -0,0 +1,104 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the program file which implements the laser class to:
+ - Calculate current location and movement information for the laser blast
+ - Detect collisions between objects to decrease their health
+ - Be scaleable to many laser blasts
+*/ 
+
+#include "LaserBlast.h"
+
+// This the constructor function for the laser
+Laser::Laser()
+{
+    //set the laser's x and initial Y based on starship
+	m_Position.x = -10;
+	m_Position.y = -10;
+
+    //initialize the bounds and position
+	m_Bounds = Bounds(m_Position.x, m_Position.y, m_Width, m_Height);
+	m_TickStartPosition = m_Position;
+}
+
+Vec2 Laser::getInterpolatedPosition(float alpha) const
+{
+    //returning the position between the start and end of the last update
+    return Vec2::lerp(m_TickStartPosition, Vec2(m_Bounds.left, m_Bounds.top), alpha);
+}
+
+Bounds Laser::getSweptPosition() const
+{
+    //returning the area from the start of the last update to the current bounds
+    Bounds start(m_TickStartPosition.x, m_TickStartPosition.y, m_Bounds.width, m_Bounds.height);
+    return start.sweptArea(getMovement());
+}
+
+void Laser::startLaser(float startX, float startY)
+{
+    //restarting the laser to be active at the given location
+    // stops having to create new laser objects every time the player shoots
+    m_Position.x = startX;
+    m_Position.y = startY;
+    m_Bounds.setPosition(m_Position);
+    m_TickStartPosition = m_Position;
+    m_Health = 1;
+}
+
+bool Laser::sweep(Bounds other, Vec2 otherMovement, float& time)
+{
+    //a dead laser can't hit anything
+    if (m_Health <= 0)
+    {
+        return false;
+    }
+
+    //moving both objects back to the start of the update, then sweeping the laser along its movement relative to the other object
+    Bounds start(m_TickStartPosition.x, m_TickStartPosition.y, m_Width, m_Height);
+    Bounds otherStart(other.left - otherMovement.x, other.top - otherMovement.y, other.width, other.height);
+    return start.sweep(getMovement() - otherMovement, otherStart, time);
+}
+
+int Laser::checkDamage(Bounds other, Vec2 otherMovement)
+{
+    //otherwise, check if the laser passed through the object. If so, do damage
+    float time;
+    if (sweep(other, otherMovement, time))
+    {
+        //objects intersect, do damage and delete the laser
+        m_Health -= 1;
+        return m_Damage;
+    }
+
+    //otherwise, return a -1 for no damage
+    return -1;
+}
+
+bool Laser::update(float dt)
+{
+    // Ensuring the laser exists
+    if (m_Health <= 0)
+    { //laser doesn't exist
+        return false;
+    }
+
+    //retiring a laser that left the screen during the last update
+    // it was kept until now so the collision checks of that update still saw the last part of its path
+    if (m_Position.y < 0)
+    {
+        m_Health = 0;
+        return false;
+    }
+
+	// Update the laser height
+	m_TickStartPosition = Vec2(m_Bounds.left, m_Bounds.top);
+	m_Position.y -= m_Speed * dt;
+
+	// Move the laser
+	m_Bounds.setPosition(m_Position);
+
+    // Returning that the laser still exists
+    return true;
+}
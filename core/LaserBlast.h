@@ -0,0 +1,139 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the class to:
+ - Calculate current location and movement information for the laser blast
+ - Detect collisions between objects to decrease their health
+ - Be scaleable to many laser blasts
+*/ 
+
+#pragma once
+#include "Geometry.h"
+#include <type_traits>
+
+class Laser
+{
+private:
+    //creating necessary objects for the location/shape
+	Vec2 m_Position;	
+	Bounds m_Bounds;
+	Vec2 m_TickStartPosition; //where the laser was drawn before the last update
+
+    //setting constant values for the object
+	static constexpr float m_Speed = 1200.0f;
+    static constexpr int m_Damage = 7;
+
+    static constexpr float m_Width = 6;
+    static constexpr float m_Height = 16;
+
+    //creating changing values for the object
+    int m_Health = 0; //identifies when the laser is deleted
+
+public:
+    /** 
+     * Constructor for the Laser class to create the laser object.
+     */
+    Laser();
+
+    // Location and Shape methods
+
+    /** 
+     * Function to simply return the bounds (position and shape) of the object.
+     * 
+     * Returns:
+     * @return reference to the rectangle bounds of the object (kept up to date only when it moves)
+     */
+    const Bounds& getPosition() const { return m_Bounds; }
+
+    /**
+     * Function to get where to draw the object between its last two updates so motion stays smooth at any refresh rate.
+     * 
+     * Parameters:
+     * @param alpha - how far between the previous update (0) and the latest update (1) to draw the object
+     *
+     * Returns:
+     * @return top left position to draw the object at
+     */
+    Vec2 getInterpolatedPosition(float alpha) const;
+
+    /**
+     * Function to simply get how far the object moved during its last update.
+     *
+     * Returns:
+     * @return the movement from the start to the end of the last update
+     */
+    Vec2 getMovement() const { return Vec2(m_Bounds.left, m_Bounds.top) - m_TickStartPosition; }
+
+    /**
+     * Function to get the area the object covered during its last update (for looking up what it may have passed through).
+     *
+     * Returns:
+     * @return the bounds box around the object's whole last movement
+     */
+    Bounds getSweptPosition() const;
+
+    // Specific methods
+
+    /** 
+     * Function to start the laser with its movement.  Allows you to not have to create new objects for every shot.
+     * 
+     * Parameters:
+     * @param startX - what x value to start the laser from
+     * @param startY - what y value to start the laser from
+     */
+    void startLaser(float startX, float startY);
+
+    /** 
+     * Function to simply see if the laser is still alive (non 1 is dead)
+     * 
+     * Returns:
+     * @return the current health value of the laser
+     */
+    int getHealth() const { return m_Health; }
+
+    // Collision and Update methods
+
+    /**
+     * Function to find when the laser first hit another object during the last update (both objects are swept along their movement).
+     *
+     * Parameters:
+     * @param other - bounds box of the other object at the end of the update
+     * @param otherMovement - how far the other object moved during the update (nothing for objects that don't move)
+     * @param time - written with how far through the update the laser first touched the object (0 is the start, 1 is the end)
+     *
+     * Returns:
+     * @return whether the laser hit the object at any point of the update
+     */
+    bool sweep(Bounds other, Vec2 otherMovement, float& time);
+
+    /** 
+     * Function to check collisions and do damage if there was a collision.
+     *  Simply takes in an object bounds and sees if the current object passed through it during the last update.
+     *  If the object is hit, kill the laser.
+     * 
+     * Parameters:
+     * @param other - bounds box of the other object to check for collision
+     * @param otherMovement - how far the other object moved during the last update (nothing for objects that don't move)
+     *
+     * Returns:
+     * @return value of how much damage to do to the other object (-1 means no collision occured)
+     */
+    int checkDamage(Bounds other, Vec2 otherMovement = Vec2());
+
+    /** 
+     * Function to update the positions and values of the laser based on timing.
+     * 
+     * Parameters:
+     * @param dt - how long it has been (in seconds) since the last update to move the object accordingly far
+     *
+     * Returns:
+     * @return whether the laser is still alive or not
+     */
+    bool update(float dt);
+};
+
+//keeping the laser small and plain to copy (the laser pool can hold thousands and updates them every step)
+static_assert(sizeof(Laser) <= 40, "Laser grew past its size budget");
+static_assert(std::is_trivially_copyable<Laser>::value, "Laser must stay trivially copyable");
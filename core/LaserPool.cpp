@@ -0,0 +1,73 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the program file which implements the laser pool class to:
+ - Hold every laser the ship can have in flight at once (the capacity can be raised into the thousands for stress tests)
+ - Fire from a free list and keep the lasers in flight in a compact active list (oldest shot first)
+ - Update only the lasers in flight, giving the dead ones back to the free list as they go
+*/
+
+#include "LaserPool.h"
+
+LaserPool::LaserPool(int capacity)
+{
+    setCapacity(capacity);
+}
+
+void LaserPool::setCapacity(int capacity)
+{
+    //creating the lasers and making room in the lists for all of them
+    capacity = (capacity > 0) ? capacity : 1;
+    m_Lasers.clear();
+    m_Lasers.resize(capacity);
+    m_Free.reserve(capacity);
+    m_Active.reserve(capacity);
+    clear();
+}
+
+void LaserPool::clear()
+{
+    //every laser is free, with the first laser on top to be fired first
+    m_Active.clear();
+    m_Free.clear();
+    for (int i = getCapacity() - 1; i >= 0; --i)
+    {
+        m_Free.push_back(i);
+    }
+}
+
+bool LaserPool::fire(float startX, float startY)
+{
+    //ensuring there is a laser left to fire
+    if (m_Free.empty())
+    {
+        return false;
+    }
+
+    //starting the free laser and adding it to the end of the active list
+    int index = m_Free.back();
+    m_Free.pop_back();
+    m_Lasers[index].startLaser(startX, startY);
+    m_Active.push_back(index);
+    return true;
+}
+
+void LaserPool::update(float dt)
+{
+    //updating the lasers in flight and keeping the ones still alive packed in order at the front of the list
+    int alive = 0;
+    for (int a = 0; a < (int) m_Active.size(); ++a)
+    {
+        int index = m_Active[a];
+        m_Lasers[index].update(dt);
+        if (m_Lasers[index].getHealth() <= 0)
+        { //laser hit something or left the screen during the last update, give it back
+            m_Free.push_back(index);
+            continue;
+        }
+        m_Active[alive++] = index;
+    }
+    m_Active.resize(alive);
+}
@@ -0,0 +1,127 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the laser pool class to:
+ - Hold every laser the ship can have in flight at once (the capacity can be raised into the thousands for stress tests)
+ - Fire from a free list and keep the lasers in flight in a compact active list (oldest shot first)
+ - Update only the lasers in flight, giving the dead ones back to the free list as they go
+*/
+
+#pragma once
+#include "LaserBlast.h"
+#include <vector>
+
+class LaserPool
+{
+private:
+    //setting constant values for the pool
+    static constexpr int m_DefaultCapacity = 30; //the original game's laser count
+
+    //creating the laser lists
+    std::vector<Laser> m_Lasers; //every laser, in flight or not (only resized when the capacity changes)
+    std::vector<int> m_Free; //lasers not in flight, the next shot takes the last one
+    std::vector<int> m_Active; //lasers in flight, oldest shot first
+
+public:
+    /**
+     * Constructor for the LaserPool class which creates every laser up front.
+     *
+     * Parameters:
+     * @param capacity - how many lasers can be in flight at once
+     */
+    LaserPool(int capacity = m_DefaultCapacity);
+
+    /**
+     * Function to change how many lasers can be in flight at once (every laser is put back in the pool).
+     *
+     * Parameters:
+     * @param capacity - how many lasers can be in flight at once (at least 1)
+     */
+    void setCapacity(int capacity);
+
+    /**
+     * Function to simply get how many lasers can be in flight at once
+     *
+     * Returns:
+     * @return the capacity of the pool
+     */
+    int getCapacity() const { return (int) m_Lasers.size(); }
+
+    /**
+     * Function to put every laser back in the pool (keeps the memory).
+     */
+    void clear();
+
+    /**
+     * Function to fire the next free laser from a position.
+     *
+     * Parameters:
+     * @param startX - what x value to start the laser from
+     * @param startY - what y value to start the laser from
+     *
+     * Returns:
+     * @return whether a laser was fired (false if every laser is already in flight)
+     */
+    bool fire(float startX, float startY);
+
+    /**
+     * Function to update every laser in flight and put the ones that died (by hitting something or leaving the screen during the last update) back in the pool.
+     *
+     * Parameters:
+     * @param dt - how long it has been (in seconds) since the last update to move the lasers accordingly far
+     */
+    void update(float dt);
+
+    /**
+     * Function to simply get how many lasers are in the active list.
+     *  A laser that hit something since the last update is still listed (with no health) until the next update,
+     *  and so is a laser that left the screen during the last update (so its last movement is still checked for hits).
+     *
+     * Returns:
+     * @return the number of active lasers
+     */
+    int getActiveCount() const { return (int) m_Active.size(); }
+
+    /**
+     * Function to simply get a laser of the active list
+     *
+     * Parameters:
+     * @param index - which active laser (0 is the oldest shot)
+     *
+     * Returns:
+     * @return reference to the laser
+     */
+    Laser& getActive(int index) { return m_Lasers[m_Active[index]]; }
+
+    /**
+     * Function to simply get which slot of the pool an active laser is in (it keeps that slot for as long as it is in flight)
+     *
+     * Parameters:
+     * @param index - which active laser
+     *
+     * Returns:
+     * @return the slot of the laser (0 up to the capacity)
+     */
+    int getActiveSlot(int index) const { return m_Active[index]; }
+
+    /**
+     * Function to simply get how many lasers are free to be fired
+     *
+     * Returns:
+     * @return the number of free lasers
+     */
+    int getFreeCount() const { return (int) m_Free.size(); }
+
+    /**
+     * Function to simply get which slot of the pool a free laser is in
+     *
+     * Parameters:
+     * @param index - which free laser
+     *
+     * Returns:
+     * @return the slot of the laser (0 up to the capacity)
+     */
+    int getFreeSlot(int index) const { return m_Free[index]; }
+};
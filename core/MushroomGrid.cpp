@@ -0,0 +1,228 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the program file which implements the mushroom grid class to:
+ - Index the mushroom field by its 35 px grid cells (cell -> index of the mushroom in the world's vector)
+ - Answer placement and overlap checks with a single cell lookup instead of scanning every mushroom
+ - Find the few mushrooms under a moving object's bounds so collision cost follows the moving objects, not the field size
+ - Mirror the field as bitboards (one bit per cell, 64 cells per word) for occupancy and for each health band,
+   so row span checks and band sweeps are a few word operations instead of a loop over the mushrooms
+*/
+
+#include "MushroomGrid.h"
+#include <algorithm>
+#include <cmath>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * Function to find the lowest set bit of a word.
+ *
+ * Parameters:
+ * @param word - the word to look in (must not be 0)
+ *
+ * Returns:
+ * @return the position of the lowest set bit (0 to 63)
+ */
+static int lowestBit(uint64_t word)
+{
+#if defined(_MSC_VER)
+    unsigned long bit;
+    _BitScanForward64(&bit, word);
+    return (int) bit;
+#else
+    return __builtin_ctzll(word);
+#endif
+}
+
+void MushroomGrid::reset(float width, float height)
+{
+    //one cell for every grid spot on the field (plus one for partial cells on the right and bottom)
+    m_Columns = (int) std::ceil(width / m_CellSize) + 1;
+    m_Rows = (int) std::ceil(height / m_CellSize) + 1;
+    m_Cells.assign(m_Columns * m_Rows, -1);
+
+    //one bit per cell, every row rounded up to whole words
+    m_WordsPerRow = (m_Columns + 63) / 64;
+    m_Occupied.assign(m_WordsPerRow * m_Rows, 0);
+    for (int band = 0; band < m_Bands; ++band)
+    {
+        m_Band[band].assign(m_WordsPerRow * m_Rows, 0);
+    }
+}
+
+void MushroomGrid::clear()
+{
+    std::fill(m_Cells.begin(), m_Cells.end(), -1);
+    std::fill(m_Occupied.begin(), m_Occupied.end(), 0);
+    for (int band = 0; band < m_Bands; ++band)
+    {
+        std::fill(m_Band[band].begin(), m_Band[band].end(), 0);
+    }
+}
+
+uint64_t MushroomGrid::getSpanMask(int word, int firstColumn, int lastColumn)
+{
+    //clipping the span to the 64 columns of the word
+    int first = std::max(firstColumn - word * 64, 0);
+    int last = std::min(lastColumn - word * 64, 63);
+    if (first > last)
+    {
+        return 0;
+    }
+    uint64_t upTo = (last == 63) ? ~0ULL : ((1ULL << (last + 1)) - 1);
+    return upTo & ~((1ULL << first) - 1);
+}
+
+bool MushroomGrid::getCell(float x, float y, int& column, int& row) const
+{
+    //positions are multiples of the cell size, the half cell keeps float error from landing in the cell before
+    column = (int) std::floor(x / m_CellSize + 0.5f);
+    row = (int) std::floor(y / m_CellSize + 0.5f);
+    return column >= 0 && column < m_Columns && row >= 0 && row < m_Rows;
+}
+
+int MushroomGrid::get(int column, int row) const
+{
+    if (column < 0 || column >= m_Columns || row < 0 || row >= m_Rows)
+    {
+        return -1;
+    }
+    return m_Cells[row * m_Columns + column];
+}
+
+void MushroomGrid::set(int column, int row, int index)
+{
+    m_Cells[row * m_Columns + column] = index;
+
+    //keeping the occupancy bit in sync (an emptied cell leaves every band too)
+    int word = row * m_WordsPerRow + column / 64;
+    uint64_t bit = 1ULL << (column % 64);
+    if (index != -1)
+    {
+        m_Occupied[word] |= bit;
+    }
+    else
+    {
+        m_Occupied[word] &= ~bit;
+        for (int band = 0; band < m_Bands; ++band)
+        {
+            m_Band[band][word] &= ~bit;
+        }
+    }
+}
+
+int MushroomGrid::getBand(int health)
+{
+    //same thresholds as the mushroom sprites
+    if (health <= 3) return 3;
+    if (health <= 6) return 2;
+    if (health <= 9) return 1;
+    return 0;
+}
+
+void MushroomGrid::setHealth(int column, int row, int health)
+{
+    //clearing the cell from every band, then setting it in its current one
+    int word = row * m_WordsPerRow + column / 64;
+    uint64_t bit = 1ULL << (column % 64);
+    for (int band = 0; band < m_Bands; ++band)
+    {
+        m_Band[band][word] &= ~bit;
+    }
+    m_Band[getBand(health)][word] |= bit;
+}
+
+bool MushroomGrid::anyInSpan(int row, int firstColumn, int lastColumn) const
+{
+    if (row < 0 || row >= m_Rows)
+    {
+        return false;
+    }
+    firstColumn = std::max(firstColumn, 0);
+    lastColumn = std::min(lastColumn, m_Columns - 1);
+    for (int word = firstColumn / 64; word <= lastColumn / 64 && firstColumn <= lastColumn; ++word)
+    {
+        if (m_Occupied[row * m_WordsPerRow + word] & getSpanMask(word, firstColumn, lastColumn))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void MushroomGrid::gatherBand(int band, std::vector<int>& found) const
+{
+    //walking the set bits of every word (empty words cost one compare)
+    for (int row = 0; row < m_Rows; ++row)
+    {
+        for (int word = 0; word < m_WordsPerRow; ++word)
+        {
+            for (uint64_t bits = m_Band[band][row * m_WordsPerRow + word]; bits != 0; bits &= bits - 1)
+            {
+                found.push_back(m_Cells[row * m_Columns + word * 64 + lowestBit(bits)]);
+            }
+        }
+    }
+}
+
+bool MushroomGrid::gatherChanges(std::vector<uint64_t>* seen, std::vector<int>& changed) const
+{
+    //starting the copy over as an empty field if it doesn't match the grid
+    bool matched = true;
+    for (int band = 0; band < m_Bands; ++band)
+    {
+        matched = matched && (seen[band].size() == m_Band[band].size());
+    }
+    if (!matched)
+    {
+        for (int band = 0; band < m_Bands; ++band)
+        {
+            seen[band].assign(m_Band[band].size(), 0);
+        }
+    }
+
+    //a cell changed if its bit differs in any band (an emptied or filled cell is in a band on only one side)
+    for (int row = 0; row < m_Rows; ++row)
+    {
+        for (int word = 0; word < m_WordsPerRow; ++word)
+        {
+            int index = row * m_WordsPerRow + word;
+            uint64_t bits = 0;
+            for (int band = 0; band < m_Bands; ++band)
+            {
+                bits |= seen[band][index] ^ m_Band[band][index];
+                seen[band][index] = m_Band[band][index];
+            }
+            for (; bits != 0; bits &= bits - 1)
+            {
+                changed.push_back(row * m_Columns + word * 64 + lowestBit(bits));
+            }
+        }
+    }
+    return matched;
+}
+
+void MushroomGrid::query(const Bounds& area, std::vector<int>& found) const
+{
+    //every cell whose mushroom could touch the area (a mushroom sits at the top left of its cell)
+    int firstColumn = std::max((int) std::floor(area.left / m_CellSize), 0);
+    int lastColumn = std::min((int) std::floor((area.left + area.width) / m_CellSize), m_Columns - 1);
+    int firstRow = std::max((int) std::floor(area.top / m_CellSize), 0);
+    int lastRow = std::min((int) std::floor((area.top + area.height) / m_CellSize), m_Rows - 1);
+
+    //gathering the mushrooms in those cells (only the set bits of every row span are visited)
+    for (int row = firstRow; row <= lastRow && firstColumn <= lastColumn; ++row)
+    {
+        for (int word = firstColumn / 64; word <= lastColumn / 64; ++word)
+        {
+            for (uint64_t bits = m_Occupied[row * m_WordsPerRow + word] & getSpanMask(word, firstColumn, lastColumn); bits != 0; bits &= bits - 1)
+            {
+                found.push_back(m_Cells[row * m_Columns + word * 64 + lowestBit(bits)]);
+            }
+        }
+    }
+}
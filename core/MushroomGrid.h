@@ -0,0 +1,188 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the mushroom grid class to:
+ - Index the mushroom field by its 35 px grid cells (cell -> index of the mushroom in the world's vector)
+ - Answer placement and overlap checks with a single cell lookup instead of scanning every mushroom
+ - Find the few mushrooms under a moving object's bounds so collision cost follows the moving objects, not the field size
+ - Mirror the field as bitboards (one bit per cell, 64 cells per word) for occupancy and for each health band,
+   so row span checks and band sweeps are a few word operations instead of a loop over the mushrooms
+*/
+
+#pragma once
+#include "Geometry.h"
+#include <cstdint>
+#include <vector>
+
+class MushroomGrid
+{
+private:
+    //setting constant values for the grid
+    static constexpr float m_CellSize = 35.0f; //mushrooms are always snapped to this grid
+
+    //creating the grid values
+    int m_Columns = 0;
+    int m_Rows = 0;
+    std::vector<int> m_Cells; //index of the mushroom in every cell (-1 if empty), row by row
+
+    //creating the bitboards (every row starts on a new word)
+    static constexpr int m_Bands = 4; //health bands, matching the 4 mushroom sprites
+    int m_WordsPerRow = 0;
+    std::vector<uint64_t> m_Occupied; //bit set for every cell holding a mushroom
+    std::vector<uint64_t> m_Band[m_Bands]; //bit set for every cell whose mushroom is in that health band
+
+    /**
+     * Private function to get the mask of the bits from a first to a last column within one word of a row.
+     *
+     * Parameters:
+     * @param word - which word of the row
+     * @param firstColumn - the first column of the span
+     * @param lastColumn - the last column of the span
+     *
+     * Returns:
+     * @return the bits of the span that fall in the word (0 if none do)
+     */
+    static uint64_t getSpanMask(int word, int firstColumn, int lastColumn);
+
+public:
+    /**
+     * Function to size the grid to a playing field and empty it.
+     *
+     * Parameters:
+     * @param width - the logical width of the playing field
+     * @param height - the logical height of the playing field
+     */
+    void reset(float width, float height);
+
+    /**
+     * Function to empty every cell of the grid.
+     */
+    void clear();
+
+    /**
+     * Function to simply get the size of a cell
+     *
+     * Returns:
+     * @return the width and height of every cell
+     */
+    static float getCellSize() { return m_CellSize; }
+
+    /**
+     * Function to simply get how many columns of cells there are
+     *
+     * Returns:
+     * @return the number of columns
+     */
+    int getColumns() const { return m_Columns; }
+
+    /**
+     * Function to get the cell a grid snapped position is in.
+     *
+     * Parameters:
+     * @param x - the left of the mushroom
+     * @param y - the top of the mushroom
+     * @param column - written with the column of the cell
+     * @param row - written with the row of the cell
+     *
+     * Returns:
+     * @return whether the position is inside the grid
+     */
+    bool getCell(float x, float y, int& column, int& row) const;
+
+    /**
+     * Function to simply get the mushroom in a cell
+     *
+     * Parameters:
+     * @param column - the column of the cell
+     * @param row - the row of the cell
+     *
+     * Returns:
+     * @return the index of the mushroom in the cell, or -1 if it is empty (or outside the grid)
+     */
+    int get(int column, int row) const;
+
+    /**
+     * Function to simply set the mushroom in a cell
+     *
+     * Parameters:
+     * @param column - the column of the cell (must be inside the grid)
+     * @param row - the row of the cell (must be inside the grid)
+     * @param index - the index of the mushroom in the cell, or -1 to empty it
+     */
+    void set(int column, int row, int index);
+
+    /**
+     * Function to find which health band (and sprite) a mushroom's health falls in.
+     *
+     * Parameters:
+     * @param health - the mushroom's health
+     *
+     * Returns:
+     * @return 0 for basically no damage, up to 3 for the final bit of health
+     */
+    static int getBand(int health);
+
+    /**
+     * Function to simply get how many health bands there are
+     *
+     * Returns:
+     * @return the number of bands (one per mushroom sprite)
+     */
+    static int getBandCount() { return m_Bands; }
+
+    /**
+     * Function to move the mushroom in a cell to the health band of its current health.
+     *
+     * Parameters:
+     * @param column - the column of the cell (must be inside the grid and hold a mushroom)
+     * @param row - the row of the cell (must be inside the grid and hold a mushroom)
+     * @param health - the mushroom's health
+     */
+    void setHealth(int column, int row, int health);
+
+    /**
+     * Function to check if any cell of a row span holds a mushroom (a word at a time).
+     *
+     * Parameters:
+     * @param row - the row to check
+     * @param firstColumn - the first column of the span
+     * @param lastColumn - the last column of the span (spans are clipped to the grid)
+     *
+     * Returns:
+     * @return whether there is a mushroom anywhere in the span
+     */
+    bool anyInSpan(int row, int firstColumn, int lastColumn) const;
+
+    /**
+     * Function to add the index of every mushroom in a health band to a list (row by row, left to right).
+     *
+     * Parameters:
+     * @param band - the health band to gather (see getBand)
+     * @param found - the list the indices are added to
+     */
+    void gatherBand(int band, std::vector<int>& found) const;
+
+    /**
+     * Function to find every cell that looks different than in a copy of the health bands (a mushroom was added, removed,
+     *  or moved to another band since), and bring the copy up to date. Costs a few word operations per row, however full the field is.
+     *
+     * Parameters:
+     * @param seen - the copy of the bitboard of each health band (getBandCount of them), kept by the caller between calls
+     * @param changed - the list the changed cells are added to (as row * getColumns() + column)
+     *
+     * Returns:
+     * @return whether the copy was taken from a grid this size (if not, it is started over as an empty field first)
+     */
+    bool gatherChanges(std::vector<uint64_t>* seen, std::vector<int>& changed) const;
+
+    /**
+     * Function to find the mushrooms in every cell that an area overlaps (the caller still checks the exact bounds).
+     *
+     * Parameters:
+     * @param area - the bounds of the object to find the mushrooms under (any size, a swept box can cover many cells)
+     * @param found - the list the indices of the mushrooms found are added to
+     */
+    void query(const Bounds& area, std::vector<int>& found) const;
+};
@@ -0,0 +1,65 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the program file which implements the mushroom store class to:
+ - Hold every mushroom of the field as dense parallel arrays (position, health, damage timer) instead of one object per mushroom
+ - Add and remove mushrooms in constant time (removing moves the last mushroom into the gap, like the grid expects)
+ - Hand out slot map handles so a mushroom can be held on to (and found again) while others are being removed
+ - Apply the mushroom rules (damage delay, points) to a mushroom by its index
+*/
+
+#include "MushroomStore.h"
+
+void MushroomStore::clear()
+{
+    m_Slots.clear();
+    m_Left.clear();
+    m_Top.clear();
+    m_Health.clear();
+    m_LastDamageTime.clear();
+}
+
+int MushroomStore::add(float x, float y, double time)
+{
+    //a new mushroom has full health and has to wait the damage delay before its first hit
+    m_Left.push_back(x);
+    m_Top.push_back(y);
+    m_Health.push_back(m_StartingHealth);
+    m_LastDamageTime.push_back(time);
+    m_Slots.add();
+    return size() - 1;
+}
+
+int MushroomStore::remove(SlotHandle handle)
+{
+    //ignoring mushrooms that are already gone
+    int index = m_Slots.remove(handle);
+    if (index == -1)
+    {
+        return -1;
+    }
+
+    //moving the last mushroom into the removed one's place in every array
+    int last = size() - 1;
+    m_Left[index] = m_Left[last];
+    m_Top[index] = m_Top[last];
+    m_Health[index] = m_Health[last];
+    m_LastDamageTime[index] = m_LastDamageTime[last];
+    m_Left.pop_back();
+    m_Top.pop_back();
+    m_Health.pop_back();
+    m_LastDamageTime.pop_back();
+    return index;
+}
+
+void MushroomStore::doDamage(int index, int damage, double time)
+{
+    //ensure enough time has passed to only allow damage a few times a second
+    if (time - m_LastDamageTime[index] >= m_DamageDelay)
+    { //enough time has passed, do the damage
+        m_Health[index] -= damage;
+        m_LastDamageTime[index] = time;
+    }
+}
@@ -0,0 +1,135 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the mushroom store class to:
+ - Hold every mushroom of the field as dense parallel arrays (position, health, damage timer) instead of one object per mushroom
+ - Add and remove mushrooms in constant time (removing moves the last mushroom into the gap, like the grid expects)
+ - Hand out slot map handles so a mushroom can be held on to (and found again) while others are being removed
+ - Apply the mushroom rules (damage delay, points) to a mushroom by its index
+*/
+
+#pragma once
+#include "Geometry.h"
+#include "SlotMap.h"
+#include <vector>
+
+class MushroomStore
+{
+private:
+    //setting constant values shared by every mushroom
+    static constexpr float m_Width = 30;
+    static constexpr float m_Height = 30;
+    static constexpr int m_StartingHealth = 12;
+    static constexpr int m_Points = 4;
+    static constexpr double m_DamageDelay = 0.2; //seconds between hits that can do damage
+
+    //creating the mushroom arrays (the same index in every array is the same mushroom)
+    SlotIndex m_Slots; //handle -> index in the arrays, moved along with the mushrooms
+    std::vector<float> m_Left;
+    std::vector<float> m_Top;
+    std::vector<int> m_Health; //identifies which stage the mushroom is in for display
+    std::vector<double> m_LastDamageTime; //game time of the last damage (or of creation) to only allow damage a few times a second
+
+public:
+    /**
+     * Function to simply get how many mushrooms are in the field
+     *
+     * Returns:
+     * @return the number of mushrooms
+     */
+    int size() const { return (int) m_Left.size(); }
+
+    /**
+     * Function to remove every mushroom (keeps the memory for the next field).
+     */
+    void clear();
+
+    /**
+     * Function to add a mushroom to the end of the arrays.
+     *
+     * Parameters:
+     * @param x - the x position of the mushroom
+     * @param y - the y position of the mushroom
+     * @param time - the game time (in seconds) the mushroom is created at
+     *
+     * Returns:
+     * @return the index of the new mushroom
+     */
+    int add(float x, float y, double time);
+
+    /**
+     * Function to remove a mushroom by moving the last mushroom into its place (no other index changes).
+     *
+     * Parameters:
+     * @param handle - the handle of the mushroom to remove
+     *
+     * Returns:
+     * @return the index the mushroom was at (the last mushroom is there now), or -1 if it was already removed
+     */
+    int remove(SlotHandle handle);
+
+    /**
+     * Function to simply get the handle of the mushroom at an index (stays the same while other mushrooms are removed)
+     *
+     * Parameters:
+     * @param index - which mushroom
+     *
+     * Returns:
+     * @return the handle of the mushroom
+     */
+    SlotHandle getHandle(int index) const { return m_Slots.getHandle(index); }
+
+    /**
+     * Function to simply find the current index of a mushroom from its handle
+     *
+     * Parameters:
+     * @param handle - the handle of the mushroom
+     *
+     * Returns:
+     * @return the index of the mushroom, or -1 if it was removed
+     */
+    int find(SlotHandle handle) const { return m_Slots.find(handle); }
+
+    /**
+     * Function to simply return the bounds (position and shape) of a mushroom.
+     *
+     * Parameters:
+     * @param index - which mushroom
+     *
+     * Returns:
+     * @return rectangle bounds of the mushroom
+     */
+    Bounds getPosition(int index) const { return Bounds(m_Left[index], m_Top[index], m_Width, m_Height); }
+
+    /**
+     * Function to simply get a mushroom's current health
+     *
+     * Parameters:
+     * @param index - which mushroom
+     *
+     * Returns:
+     * @return the health value (0 or less once destroyed)
+     */
+    int getHealth(int index) const { return m_Health[index]; }
+
+    /**
+     * Function to simply get how many points destroying a mushroom is worth
+     *
+     * Returns:
+     * @return the point value of a mushroom
+     */
+    static int getPoints() { return m_Points; }
+
+    /**
+     * Function to damage a mushroom if it hasn't been damaged too recently.
+     *  Prevents a mushroom being destroyed instantly if an object gets stuck in it.
+     *
+     * Parameters:
+     * @param index - which mushroom
+     * @param damage - how much damage to do
+     * @param time - the current game time (in seconds)
+     */
+    void doDamage(int index, int damage, double time);
+};
@@ -0,0 +1,214 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the program file which implements the path history class to:
+ - Record where a centipede head has been as a ring buffer of points (one per turn, straight runs just stretch the last point), each with how far the head had travelled to get there
+ - Give the point a set distance back along the path (so every follower keeps exactly its spacing at any frame rate)
+ - Only keep as much of the path as the followers can reach, growing the buffer if a chain ever needs more
+*/
+
+#include "PathHistory.h"
+#include <cmath>
+
+PathHistory::PathHistory(float reach)
+{
+    m_Reach = reach;
+    m_Points.resize(64);
+}
+
+void PathHistory::clear()
+{
+    m_First = 0;
+    m_Count = 0;
+}
+
+void PathHistory::setReach(float reach)
+{
+    m_Reach = reach;
+}
+
+void PathHistory::copyBehind(const PathHistory& other, float distance, float reach)
+{
+    //starting over with the new reach
+    clear();
+    m_Reach = reach;
+    if (other.m_Count == 0)
+    {
+        return;
+    }
+
+    //finding the oldest point of the other path still in reach of the new newest point (keeping the one before it to sample up to)
+    double end = other.at(other.m_Count - 1).distance - distance;
+    double start = end - reach;
+    int first = 0;
+    while (first < other.m_Count - 1 && other.at(first + 1).distance <= start)
+    {
+        first++;
+    }
+
+    //making room for the points up front, then copying them up to the new newest point
+    int count = other.m_Count - first + 1;
+    while ((int) m_Points.size() < count)
+    {
+        m_Points.resize(m_Points.size() * 2);
+    }
+    for (int i = first; i < other.m_Count && other.at(i).distance < end; ++i)
+    {
+        m_Points[m_Count++] = other.at(i);
+    }
+    Vec2 position = other.sample(distance);
+    if (m_Count == 0 || at(m_Count - 1).position.x != position.x || at(m_Count - 1).position.y != position.y)
+    {
+        m_Points[m_Count++] = { position, (end > other.at(0).distance) ? end : other.at(0).distance };
+    }
+}
+
+void PathHistory::grow()
+{
+    //copying the points out oldest first into a buffer twice the size
+    std::vector<PathPoint> points(m_Points.size() * 2);
+    for (int i = 0; i < m_Count; ++i)
+    {
+        points[i] = at(i);
+    }
+    m_Points.swap(points);
+    m_First = 0;
+}
+
+void PathHistory::push(Vec2 position)
+{
+    //the first point starts the path
+    if (m_Count == 0)
+    {
+        m_Points[m_First] = { position, 0.0 };
+        m_Count = 1;
+        return;
+    }
+
+    //ignoring a head that didn't move
+    int newest = (m_First + m_Count - 1) & ((int) m_Points.size() - 1);
+    Vec2 move = position - m_Points[newest].position;
+    float length = std::sqrt(move.x * move.x + move.y * move.y);
+    if (length <= 0)
+    {
+        return;
+    }
+    double distance = m_Points[newest].distance + length;
+
+    //a head still going the same way just stretches the last stretch of the path (so only its turns take up points)
+    if (m_Count >= 2)
+    {
+        Vec2 last = m_Points[newest].position - at(m_Count - 2).position;
+        if (last.x * move.y - last.y * move.x == 0 && last.x * move.x + last.y * move.y > 0)
+        {
+            m_Points[newest] = { position, distance };
+            return;
+        }
+    }
+
+    //dropping the oldest points once the one after them already reaches as far back as any follower samples
+    while (m_Count > 2 && distance - at(1).distance >= m_Reach)
+    {
+        m_First = (m_First + 1) & ((int) m_Points.size() - 1);
+        m_Count--;
+    }
+
+    //adding the point (growing if every point is still needed)
+    if (m_Count == (int) m_Points.size())
+    {
+        grow();
+    }
+    m_Points[(m_First + m_Count) & ((int) m_Points.size() - 1)] = { position, distance };
+    m_Count++;
+}
+
+Vec2 PathHistory::sample(float distance) const
+{
+    //an empty path has nothing to give
+    if (m_Count == 0)
+    {
+        return Vec2();
+    }
+
+    //finding the first point at or past the target distance (a binary search, the distances only go up)
+    double target = at(m_Count - 1).distance - distance;
+    if (target <= at(0).distance)
+    {
+        return at(0).position;
+    }
+    int low = 1;
+    int high = m_Count - 1;
+    while (low < high)
+    {
+        int middle = (low + high) / 2;
+        if (at(middle).distance < target)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return interpolate(low, target);
+}
+
+Vec2 PathHistory::sample(float distance, int& cursor) const
+{
+    //an empty path has nothing to give
+    if (m_Count == 0)
+    {
+        return Vec2();
+    }
+
+    //stepping back from the cursor to the first point at or past the target distance
+    double target = at(m_Count - 1).distance - distance;
+    if (target <= at(0).distance)
+    {
+        cursor = 0;
+        return at(0).position;
+    }
+    if (cursor < 1 || cursor >= m_Count || at(cursor).distance < target)
+    { //starting from the newest point (the cursor is new, or from a sample further back)
+        cursor = m_Count - 1;
+    }
+    while (at(cursor - 1).distance >= target)
+    {
+        cursor--;
+    }
+    return interpolate(cursor, target);
+}
+
+Vec2 PathHistory::interpolate(int index, double target) const
+{
+    //placing the spot between the point and the one before it
+    const PathPoint& before = at(index - 1);
+    const PathPoint& after = at(index);
+    float alpha = (float) ((target - before.distance) / (after.distance - before.distance));
+    return Vec2::lerp(before.position, after.position, alpha);
+}
+
+void PathHistory::cutNewest(float distance)
+{
+    //finding the new newest point, then dropping every point past it
+    if (m_Count == 0)
+    {
+        return;
+    }
+    Vec2 position = sample(distance);
+    double target = at(m_Count - 1).distance - distance;
+    while (m_Count > 1 && at(m_Count - 2).distance >= target)
+    {
+        m_Count--;
+    }
+
+    //replacing the newest point with the cut point (the path can't go back further than its oldest point)
+    if (m_Count == 1)
+    {
+        m_Points[m_First] = { position, at(0).distance };
+        return;
+    }
+    m_Points[(m_First + m_Count - 1) & ((int) m_Points.size() - 1)] = { position, (target > at(0).distance) ? target : at(0).distance };
+}
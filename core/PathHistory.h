@@ -0,0 +1,149 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the path history class to:
+ - Record where a centipede head has been as a ring buffer of points (one per turn, straight runs just stretch the last point), each with how far the head had travelled to get there
+ - Give the point a set distance back along the path (so every follower keeps exactly its spacing at any frame rate)
+ - Only keep as much of the path as the followers can reach, growing the buffer if a chain ever needs more
+*/
+
+#pragma once
+#include "Geometry.h"
+#include <vector>
+
+class PathHistory
+{
+private:
+    //one recorded position of the head
+    struct PathPoint
+    {
+        Vec2 position;
+        double distance; //how far the head had travelled along the path to get here (double so long games don't lose precision)
+    };
+
+    //creating the ring buffer (its size is always a power of two so wrapping is a mask)
+    std::vector<PathPoint> m_Points;
+    int m_First = 0; //buffer index of the oldest point
+    int m_Count = 0;
+    float m_Reach = 0; //how far back along the path samples are taken (older points are dropped)
+
+    /**
+     * Private function to get a point by its age.
+     *
+     * Parameters:
+     * @param index - 0 for the oldest point up to size() - 1 for the newest
+     *
+     * Returns:
+     * @return reference to the point
+     */
+    const PathPoint& at(int index) const { return m_Points[(m_First + index) & ((int) m_Points.size() - 1)]; }
+
+    /**
+     * Private function to double the size of the buffer (keeping every point).
+     */
+    void grow();
+
+    /**
+     * Private function to get the spot on the path between a point and the one before it.
+     *
+     * Parameters:
+     * @param index - age of the point at or just past the spot (at least 1)
+     * @param target - how far the head had travelled when it was at the spot
+     *
+     * Returns:
+     * @return the spot on the path
+     */
+    Vec2 interpolate(int index, double target) const;
+
+public:
+    /**
+     * Constructor for the PathHistory class.
+     *
+     * Parameters:
+     * @param reach - how far back along the path samples will be taken
+     */
+    PathHistory(float reach = 0);
+
+    /**
+     * Function to simply get how many points are recorded
+     *
+     * Returns:
+     * @return the number of points
+     */
+    int size() const { return m_Count; }
+
+    /**
+     * Function to forget every point (keeps the memory).
+     */
+    void clear();
+
+    /**
+     * Function to set how far back along the path samples will be taken (points older than that are dropped as the head moves on).
+     *
+     * Parameters:
+     * @param reach - how far back along the path samples will be taken
+     */
+    void setReach(float reach);
+
+    /**
+     * Function to simply get how far back along the path samples will be taken
+     *
+     * Returns:
+     * @return the reach of the path
+     */
+    float getReach() const { return m_Reach; }
+
+    /**
+     * Function to replace this path with the part of another path starting a distance back from its newest point.
+     *  Only as much of the other path as this one can reach is copied.
+     *
+     * Parameters:
+     * @param other - the path to copy from
+     * @param distance - how far back along the other path this path's newest point is
+     * @param reach - how far back along this path samples will be taken
+     */
+    void copyBehind(const PathHistory& other, float distance, float reach);
+
+    /**
+     * Function to record the head's newest position (nothing is recorded if it didn't move, and going straight on only moves the newest point).
+     *
+     * Parameters:
+     * @param position - where the head is now
+     */
+    void push(Vec2 position);
+
+    /**
+     * Function to get the point a distance back along the path from the newest point.
+     *
+     * Parameters:
+     * @param distance - how far back along the path to go
+     *
+     * Returns:
+     * @return the point on the path (the oldest point if the path doesn't go back that far)
+     */
+    Vec2 sample(float distance) const;
+
+    /**
+     * Function to get the point a distance back along the path, searching back from where the last sample was found.
+     *  Sampling a row of followers front to back this way only steps over each point once.
+     *
+     * Parameters:
+     * @param distance - how far back along the path to go (at least as far as the last sample with this cursor)
+     * @param cursor - where the search starts and is left for the next sample (start it at -1 for the newest point)
+     *
+     * Returns:
+     * @return the point on the path (the oldest point if the path doesn't go back that far)
+     */
+    Vec2 sample(float distance, int& cursor) const;
+
+    /**
+     * Function to cut the newest part of the path off, leaving the point that distance back as the newest.
+     *  Used when a segment behind the head takes over leading the path.
+     *
+     * Parameters:
+     * @param distance - how much of the path to cut off
+     */
+    void cutNewest(float distance);
+};
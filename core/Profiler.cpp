@@ -0,0 +1,105 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the program file which implements the profiler class to:
+ - Time named zones of the game loop (input, update, collision, draw, display, and each kind of object) with scoped timers
+ - Count per-frame values (collision tests, live mushrooms and centipede segments) alongside the timings
+ - Keep the last frames in a lock-free ring buffer so a HUD (or another thread) can read them while the game runs
+ - Hand every frame and zone (plus instant marks like round changes) to a trace writer when one is set
+*/
+
+#include "Profiler.h"
+
+thread_local Profiler* Profiler::m_Active = nullptr;
+
+const char* Profiler::getZoneName(Zone zone)
+{
+    //names in the same order as the Zone enum
+    static const char* names[ZONE_COUNT] = {
+        "input", "update", "update ship", "update spider", "update centipede", "collision",
+        "draw", "draw ship", "draw mushrooms", "draw spider", "draw centipede", "draw overlay", "display",
+        "load assets", "begin match", "start round"
+    };
+    return (zone >= 0 && zone < ZONE_COUNT) ? names[zone] : "unknown";
+}
+
+void Profiler::nextFrame()
+{
+    //finishing the frame being recorded and starting the next from nothing
+    endFrame();
+    m_Frame = FrameProfile();
+    m_FrameStart = Clock::now();
+    m_FrameStartAllocations = AllocationTracker::getThreadTotals();
+    m_InFrame = true;
+}
+
+void Profiler::endFrame()
+{
+    //ensuring a frame is being recorded
+    if (!m_InFrame)
+    {
+        return;
+    }
+    Clock::time_point now = Clock::now();
+
+    //counting the frame's heap allocations
+    AllocationStats allocations = AllocationTracker::getThreadTotals();
+    m_Frame.counters[COUNTER_ALLOCATIONS] = (uint32_t) (allocations.allocations - m_FrameStartAllocations.allocations);
+    m_Frame.counters[COUNTER_ALLOCATED_BYTES] = (uint32_t) (allocations.bytes - m_FrameStartAllocations.bytes);
+
+    //publishing the frame to the history
+    uint64_t frame = m_FramesWritten.load(std::memory_order_relaxed);
+    m_Frame.frame = frame;
+    m_Frame.frameMs = std::chrono::duration<float, std::milli>(now - m_FrameStart).count();
+    //the fence keeps this slot's writes from showing up before the count the last frame published (that count is
+    //what tells a reader copying the slot's old frame that it was reused, a release store alone only orders the writes before it)
+    std::atomic_thread_fence(std::memory_order_release);
+    m_History[frame % m_HistorySize] = m_Frame;
+    m_FramesWritten.store(frame + 1, std::memory_order_release);
+    m_InFrame = false;
+
+    //handing the frame and its zones to the trace writer
+    if (m_Trace != nullptr)
+    {
+        m_TraceEvents.push_back({ "frame", "frame", 'X', m_FrameStart, now });
+        flushTrace();
+    }
+}
+
+void Profiler::setTrace(TraceWriter* trace)
+{
+    //writing out whatever was gathered for the old writer first
+    flushTrace();
+    m_Trace = trace;
+    m_TraceEvents.reserve(256);
+}
+
+void Profiler::flushTrace()
+{
+    if (m_Trace != nullptr)
+    {
+        m_Trace->submit(m_TraceEvents);
+    }
+    m_TraceEvents.clear();
+}
+
+uint64_t Profiler::getFrameCount() const
+{
+    return m_FramesWritten.load(std::memory_order_acquire);
+}
+
+bool Profiler::getFrame(uint64_t frame, FrameProfile& profile) const
+{
+    //ensuring the frame is finished and hasn't been overwritten yet
+    if (frame >= getFrameCount() || frame + m_HistorySize <= getFrameCount())
+    {
+        return false;
+    }
+    profile = m_History[frame % m_HistorySize];
+
+    //checking the slot wasn't reused while it was being copied (the slot being written belongs to frame + m_HistorySize)
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return frame + m_HistorySize > getFrameCount();
+}
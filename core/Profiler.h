@@ -0,0 +1,275 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the profiler classes to:
+ - Time named zones of the game loop (input, update, collision, draw, display, and each kind of object) with scoped timers
+ - Count per-frame values (collision tests, live mushrooms and centipede segments) alongside the timings
+ - Keep the last frames in a lock-free ring buffer so a HUD (or another thread) can read them while the game runs
+ - Hand every frame and zone (plus instant marks like round changes) to a trace writer when one is set
+
+The PROFILE_ZONE, PROFILE_COUNT, PROFILE_SET, and PROFILE_MARK macros only do anything when the game is built with CENTIPEDE_PROFILE defined
+(the CMake option of the same name), so the timers cost nothing when compiled out. When compiled in, a zone only
+reads the clock if a profiler has been made active on that thread with Profiler::setActive.
+*/
+
+#pragma once
+#include "TraceWriter.h"
+#include "AllocationTracker.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+// Public global types defined for class
+//the zones of the game loop that can be timed (sub-zones are nested inside the phase above them)
+enum Zone {
+    ZONE_INPUT = 0,
+    ZONE_UPDATE,
+    ZONE_UPDATE_SHIP,
+    ZONE_UPDATE_SPIDER,
+    ZONE_UPDATE_CENTIPEDE,
+    ZONE_COLLISION,
+    ZONE_DRAW,
+    ZONE_DRAW_SHIP,
+    ZONE_DRAW_MUSHROOMS,
+    ZONE_DRAW_SPIDER,
+    ZONE_DRAW_CENTIPEDE,
+    ZONE_DRAW_OVERLAY,
+    ZONE_DISPLAY,
+    //zones outside of the per-frame loop (only shown in traces)
+    ZONE_LOAD_ASSETS,
+    ZONE_BEGIN_MATCH,
+    ZONE_START_ROUND,
+    ZONE_COUNT
+};
+
+//the values that can be counted during a frame
+enum Counter {
+    COUNTER_TICKS = 0,
+    COUNTER_COLLISION_TESTS,
+    COUNTER_MUSHROOMS,
+    COUNTER_SEGMENTS,
+    COUNTER_ALLOCATIONS, //heap allocations made on the game thread (only counted with CENTIPEDE_TRACK_ALLOCATIONS)
+    COUNTER_ALLOCATED_BYTES,
+    COUNTER_COUNT
+};
+
+//everything recorded during one frame
+struct FrameProfile
+{
+    uint64_t frame = 0; //the number of the frame since the profiler was created
+    float frameMs = 0; //how long the whole frame took
+    float zoneMs[ZONE_COUNT] = {}; //time spent in every zone during the frame (added up if a zone ran more than once)
+    uint32_t counters[COUNTER_COUNT] = {};
+};
+
+class Profiler
+{
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    //setting constant values for the profiler
+    static const int m_HistorySize = 256; //how many of the latest frames are kept
+
+    //creating the frame history (written only by the game thread, readable from any thread)
+    FrameProfile m_History[m_HistorySize];
+    std::atomic<uint64_t> m_FramesWritten{0};
+
+    //creating changing values for the frame being recorded
+    FrameProfile m_Frame;
+    Clock::time_point m_FrameStart;
+    AllocationStats m_FrameStartAllocations; //the thread's allocation totals when the frame started
+    bool m_InFrame = false;
+
+    //creating the trace values (events are gathered during a frame and handed to the writer when it ends)
+    TraceWriter* m_Trace = nullptr;
+    std::vector<TraceEvent> m_TraceEvents;
+
+    //the profiler zones on this thread are recorded into (nullptr when nothing is being profiled)
+    static thread_local Profiler* m_Active;
+
+public:
+    /**
+     * Function to choose the profiler the zones on the calling thread are recorded into.
+     *
+     * Parameters:
+     * @param profiler - the profiler to record into, or nullptr to stop recording
+     */
+    static void setActive(Profiler* profiler) { m_Active = profiler; }
+
+    /**
+     * Function to simply get the profiler the zones on the calling thread are recorded into
+     *
+     * Returns:
+     * @return the active profiler, or nullptr if there isn't one
+     */
+    static Profiler* getActive() { return m_Active; }
+
+    /**
+     * Function to get the display name of a zone
+     *
+     * Parameters:
+     * @param zone - the zone to get the name of
+     *
+     * Returns:
+     * @return the name of the zone
+     */
+    static const char* getZoneName(Zone zone);
+
+    /**
+     * Function to finish the frame being recorded (adding it to the history) and start recording the next one.
+     */
+    void nextFrame();
+
+    /**
+     * Function to finish the frame being recorded without starting another (e.g. when leaving the game loop).
+     */
+    void endFrame();
+
+    /**
+     * Function to set the trace writer every frame, zone, and mark is handed to (nullptr to stop tracing).
+     *
+     * Parameters:
+     * @param trace - pointer to the open trace writer
+     */
+    void setTrace(TraceWriter* trace);
+
+    /**
+     * Function to hand every event gathered so far to the trace writer (done automatically at the end of every frame).
+     */
+    void flushTrace();
+
+    /**
+     * Function to add an instant mark (like a lost life) to the trace.
+     *
+     * Parameters:
+     * @param name - what happened (must be a string literal)
+     */
+    void addMark(const char* name)
+    {
+        if (m_Trace != nullptr)
+        {
+            Clock::time_point now = Clock::now();
+            m_TraceEvents.push_back({ name, "mark", 'i', now, now });
+        }
+    }
+
+    /**
+     * Function to add time spent in a zone to the frame being recorded.
+     *
+     * Parameters:
+     * @param zone - the zone the time was spent in
+     * @param start - when the zone was entered
+     * @param end - when the zone was left
+     */
+    void addZoneTime(Zone zone, Clock::time_point start, Clock::time_point end)
+    {
+        m_Frame.zoneMs[zone] += std::chrono::duration<float, std::milli>(end - start).count();
+        if (m_Trace != nullptr)
+        {
+            m_TraceEvents.push_back({ getZoneName(zone), "zone", 'X', start, end });
+        }
+    }
+
+    /**
+     * Function to add to a counter of the frame being recorded.
+     *
+     * Parameters:
+     * @param counter - the counter to add to
+     * @param amount - how much to add
+     */
+    void addCount(Counter counter, uint32_t amount) { m_Frame.counters[counter] += amount; }
+
+    /**
+     * Function to set a counter of the frame being recorded.
+     *
+     * Parameters:
+     * @param counter - the counter to set
+     * @param value - the new value of the counter
+     */
+    void setCount(Counter counter, uint32_t value) { m_Frame.counters[counter] = value; }
+
+    /**
+     * Function to simply get how many frames have been finished
+     *
+     * Returns:
+     * @return the number of finished frames
+     */
+    uint64_t getFrameCount() const;
+
+    /**
+     * Function to copy a finished frame out of the history.
+     *
+     * Parameters:
+     * @param frame - the number of the frame to get (from 0 up to getFrameCount() - 1)
+     * @param profile - written with the frame's timings and counters
+     *
+     * Returns:
+     * @return whether the frame was still in the history (only the latest frames are kept)
+     */
+    bool getFrame(uint64_t frame, FrameProfile& profile) const;
+};
+
+class ZoneTimer
+{
+private:
+    //creating the values of the zone being timed
+    Profiler* m_Profiler;
+    Zone m_Zone;
+    std::chrono::steady_clock::time_point m_Start;
+    #ifdef CENTIPEDE_TRACK_ALLOCATIONS
+    int m_PreviousZone; //the zone allocations were charged to before this one
+    #endif
+
+public:
+    /**
+     * Constructor for the ZoneTimer class which starts timing a zone (if a profiler is active on this thread).
+     *
+     * Parameters:
+     * @param zone - the zone to time until the timer goes out of scope
+     */
+    ZoneTimer(Zone zone) : m_Profiler(Profiler::getActive()), m_Zone(zone)
+    {
+        #ifdef CENTIPEDE_TRACK_ALLOCATIONS
+        m_PreviousZone = AllocationTracker::enterZone(zone);
+        #endif
+        if (m_Profiler != nullptr)
+        {
+            m_Start = std::chrono::steady_clock::now();
+        }
+    }
+
+    /**
+     * Destructor for the ZoneTimer class which adds the time spent in the zone to the active profiler.
+     */
+    ~ZoneTimer()
+    {
+        #ifdef CENTIPEDE_TRACK_ALLOCATIONS
+        AllocationTracker::leaveZone(m_PreviousZone);
+        #endif
+        if (m_Profiler != nullptr)
+        {
+            m_Profiler->addZoneTime(m_Zone, m_Start, std::chrono::steady_clock::now());
+        }
+    }
+};
+
+// Macros to time a zone until the end of the current scope and to add to a counter (nothing when compiled out)
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#ifdef CENTIPEDE_PROFILE
+#define PROFILE_ZONE(zone) ZoneTimer PROFILE_CONCAT(profileZone, __LINE__)(zone)
+#define PROFILE_COUNT(counter, amount) \
+    do { if (Profiler* profileActive = Profiler::getActive()) profileActive->addCount(counter, amount); } while (0)
+#define PROFILE_SET(counter, value) \
+    do { if (Profiler* profileActive = Profiler::getActive()) profileActive->setCount(counter, value); } while (0)
+#define PROFILE_MARK(name) \
+    do { if (Profiler* profileActive = Profiler::getActive()) profileActive->addMark(name); } while (0)
+#else
+#define PROFILE_ZONE(zone)
+#define PROFILE_COUNT(counter, amount) do { (void) (amount); } while (0)
+#define PROFILE_SET(counter, value) do {} while (0)
+#define PROFILE_MARK(name) do {} while (0)
+#endif
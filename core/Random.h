@@ -0,0 +1,80 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the random number generator class to:
+ - Give each world its own small, fast random sequence (PCG32) instead of the process-wide std::rand
+ - Repeat the exact same sequence when given the same seed so runs can be replayed and benchmarked
+*/
+
+#pragma once
+#include <cstdint>
+
+class Random
+{
+private:
+    //creating the generator state
+    uint64_t m_State = 0;
+    uint64_t m_Increment = 1;
+    uint64_t m_Seed = 0; //the seed the generator was last started from
+
+public:
+    /**
+     * Constructor for the Random class.
+     *
+     * Parameters:
+     * @param seed - the value to start the random sequence from
+     */
+    Random(uint64_t seed = 0) { setSeed(seed); }
+
+    /**
+     * Function to restart the random sequence from a seed (the same seed always gives the same sequence).
+     *
+     * Parameters:
+     * @param seed - the value to start the random sequence from
+     */
+    void setSeed(uint64_t seed)
+    {
+        m_Seed = seed;
+        m_State = 0;
+        m_Increment = (0xda3e39cb94b95bdbULL << 1u) | 1u;
+        next();
+        m_State += seed;
+        next();
+    }
+
+    /**
+     * Function to simply get the seed the sequence was last started from
+     *
+     * Returns:
+     * @return the seed value
+     */
+    uint64_t getSeed() const { return m_Seed; }
+
+    /**
+     * Function to get the next random 32 bit value in the sequence.
+     *
+     * Returns:
+     * @return the random value
+     */
+    uint32_t next()
+    {
+        uint64_t oldState = m_State;
+        m_State = oldState * 6364136223846793005ULL + m_Increment;
+        uint32_t xorShifted = (uint32_t) (((oldState >> 18u) ^ oldState) >> 27u);
+        uint32_t rotation = (uint32_t) (oldState >> 59u);
+        return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31u));
+    }
+
+    /**
+     * Function to get the next random float in the sequence (a drop in for std::rand() / RAND_MAX).
+     *
+     * Returns:
+     * @return the random value from 0 up to (not including) 1
+     */
+    float nextFloat()
+    {
+        return (float) (next() >> 8) * (1.0f / 16777216.0f);
+    }
+};
@@ -0,0 +1,70 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the program file which implements the slot index class to:
+ - Hand out handles (slot and generation) that stay the same for as long as an item lives, no matter how the items move
+ - Add and remove items in constant time while keeping them packed together (removing moves the last item into the gap)
+ - Detect a handle to an item that was already removed, instead of silently reaching whatever item took its place
+*/
+
+#include "SlotMap.h"
+
+void SlotIndex::clear()
+{
+    //freeing every live slot (bumping its generation so its handles go stale)
+    for (int i = 0; i < size(); ++i)
+    {
+        m_Generation[m_ItemSlot[i]]++;
+        m_FreeSlots.push_back(m_ItemSlot[i]);
+    }
+    m_ItemSlot.clear();
+}
+
+SlotHandle SlotIndex::add()
+{
+    //reusing a free slot if there is one, otherwise making a new one
+    uint32_t slot;
+    if (!m_FreeSlots.empty())
+    {
+        slot = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+    }
+    else
+    {
+        slot = (uint32_t) m_SlotItem.size();
+        m_SlotItem.push_back(0);
+        m_Generation.push_back(0);
+    }
+
+    //pointing the slot at the end of the packed arrays
+    m_SlotItem[slot] = (uint32_t) m_ItemSlot.size();
+    m_ItemSlot.push_back(slot);
+
+    SlotHandle handle;
+    handle.slot = slot;
+    handle.generation = m_Generation[slot];
+    return handle;
+}
+
+int SlotIndex::remove(SlotHandle handle)
+{
+    //ignoring handles to items that are already gone
+    int index = find(handle);
+    if (index == -1)
+    {
+        return -1;
+    }
+
+    //the last item moves into the removed item's place, so its slot points there now
+    uint32_t lastSlot = m_ItemSlot.back();
+    m_ItemSlot[index] = lastSlot;
+    m_SlotItem[lastSlot] = (uint32_t) index;
+    m_ItemSlot.pop_back();
+
+    //freeing the slot and making its handles stale
+    m_Generation[handle.slot]++;
+    m_FreeSlots.push_back(handle.slot);
+    return index;
+}
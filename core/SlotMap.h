@@ -0,0 +1,237 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the slot map classes to:
+ - Hand out handles (slot and generation) that stay the same for as long as an item lives, no matter how the items move
+ - Add and remove items in constant time while keeping them packed together (removing moves the last item into the gap)
+ - Detect a handle to an item that was already removed, instead of silently reaching whatever item took its place
+*/
+
+#pragma once
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+//a stable reference to an item of a slot map (the default handle never refers to anything)
+struct SlotHandle
+{
+    uint32_t slot = UINT32_MAX;
+    uint32_t generation = 0; //bumped every time the slot's item is removed so old handles stop matching
+
+    bool operator==(const SlotHandle& other) const { return slot == other.slot && generation == other.generation; }
+    bool operator!=(const SlotHandle& other) const { return !(*this == other); }
+};
+
+//the slot bookkeeping on its own, for containers that keep their items in several arrays (like the mushroom store)
+class SlotIndex
+{
+private:
+    //creating the slot arrays
+    std::vector<uint32_t> m_SlotItem; //slot -> index of its item in the packed arrays
+    std::vector<uint32_t> m_ItemSlot; //index in the packed arrays -> slot of the item
+    std::vector<uint32_t> m_Generation; //slot -> generation the slot's current item was given
+    std::vector<uint32_t> m_FreeSlots; //slots without an item, reused before new ones are made
+
+public:
+    /**
+     * Function to simply get how many items are alive
+     *
+     * Returns:
+     * @return the number of items
+     */
+    int size() const { return (int) m_ItemSlot.size(); }
+
+    /**
+     * Function to remove every item, making every handle handed out so far stale (keeps the memory).
+     */
+    void clear();
+
+    /**
+     * Function to add an item to the end of the packed arrays.
+     *
+     * Returns:
+     * @return the handle of the new item (its packed index is size() - 1)
+     */
+    SlotHandle add();
+
+    /**
+     * Function to remove an item. The caller then moves its last item into the returned index and drops the last one.
+     *
+     * Parameters:
+     * @param handle - the handle of the item to remove
+     *
+     * Returns:
+     * @return the packed index the item was at, or -1 if the handle was stale (nothing is removed)
+     */
+    int remove(SlotHandle handle);
+
+    /**
+     * Function to find where an item currently is in the packed arrays.
+     *
+     * Parameters:
+     * @param handle - the handle of the item
+     *
+     * Returns:
+     * @return the packed index of the item, or -1 if the handle is stale
+     */
+    int find(SlotHandle handle) const
+    {
+        if (handle.slot >= m_Generation.size() || m_Generation[handle.slot] != handle.generation)
+        {
+            return -1;
+        }
+        return (int) m_SlotItem[handle.slot];
+    }
+
+    /**
+     * Function to find where an item is in the packed arrays, for a handle known to be live (skips the stale check).
+     *
+     * Parameters:
+     * @param handle - the handle of a live item
+     *
+     * Returns:
+     * @return the packed index of the item
+     */
+    int findLive(SlotHandle handle) const { return (int) m_SlotItem[handle.slot]; }
+
+    /**
+     * Function to get the handle of the item at a packed index.
+     *
+     * Parameters:
+     * @param index - the packed index of a live item
+     *
+     * Returns:
+     * @return the handle of that item
+     */
+    SlotHandle getHandle(int index) const
+    {
+        SlotHandle handle;
+        handle.slot = m_ItemSlot[index];
+        handle.generation = m_Generation[handle.slot];
+        return handle;
+    }
+};
+
+//a slot map of whole objects, packed in one vector that can be looped over like any other
+template <typename T>
+class SlotMap
+{
+private:
+    //creating the items and their slots
+    SlotIndex m_Index;
+    std::vector<T> m_Items;
+
+public:
+    /**
+     * Function to simply get how many items are alive
+     *
+     * Returns:
+     * @return the number of items
+     */
+    int size() const { return (int) m_Items.size(); }
+
+    /**
+     * Function to remove every item, making every handle handed out so far stale (keeps the memory).
+     */
+    void clear()
+    {
+        m_Index.clear();
+        m_Items.clear();
+    }
+
+    /**
+     * Function to add an item to the end of the packed items.
+     *
+     * Parameters:
+     * @param item - the item to add
+     *
+     * Returns:
+     * @return the handle of the new item
+     */
+    SlotHandle add(const T& item)
+    {
+        m_Items.push_back(item);
+        return m_Index.add();
+    }
+
+    /**
+     * Function to remove an item by moving the last item into its place.
+     *
+     * Parameters:
+     * @param handle - the handle of the item to remove
+     *
+     * Returns:
+     * @return whether there was an item to remove (false if the handle was stale)
+     */
+    bool remove(SlotHandle handle)
+    {
+        int index = m_Index.remove(handle);
+        if (index == -1)
+        {
+            return false;
+        }
+        if (index != (int) m_Items.size() - 1)
+        {
+            m_Items[index] = std::move(m_Items.back());
+        }
+        m_Items.pop_back();
+        return true;
+    }
+
+    /**
+     * Function to get an item by its handle.
+     *
+     * Parameters:
+     * @param handle - the handle of the item
+     *
+     * Returns:
+     * @return pointer to the item (valid until the next add or remove), or nullptr if the handle is stale
+     */
+    T* get(SlotHandle handle)
+    {
+        int index = m_Index.find(handle);
+        return (index == -1) ? nullptr : &m_Items[index];
+    }
+
+    /**
+     * Function to get an item by a handle known to be live, like a link the items keep up to date between themselves.
+     *  Skips the stale check, so only use it for handles that can't be stale.
+     *
+     * Parameters:
+     * @param handle - the handle of a live item
+     *
+     * Returns:
+     * @return reference to the item (valid until the next add or remove)
+     */
+    T& getLive(SlotHandle handle) { return m_Items[m_Index.findLive(handle)]; }
+
+    /**
+     * Function to simply check if a handle still refers to a live item
+     *
+     * Parameters:
+     * @param handle - the handle to check
+     *
+     * Returns:
+     * @return whether the item is alive
+     */
+    bool contains(SlotHandle handle) const { return m_Index.find(handle) != -1; }
+
+    /**
+     * Function to get the handle of the item at a packed index (to keep a reference that survives removals).
+     *
+     * Parameters:
+     * @param index - the packed index of the item
+     *
+     * Returns:
+     * @return the handle of that item
+     */
+    SlotHandle getHandle(int index) const { return m_Index.getHandle(index); }
+
+    //looping over the packed items (their order changes whenever an item is removed)
+    T& operator[](int index) { return m_Items[index]; }
+    const T& operator[](int index) const { return m_Items[index]; }
+    typename std::vector<T>::iterator begin() { return m_Items.begin(); }
+    typename std::vector<T>::iterator end() { return m_Items.end(); }
+};
@@ -1,6 +1,6 @@
 /*
 Author: Dawson Pent
-Last Date Modified: 9/30/24
+Last Date Modified: 10/17/26
 
 Description:
 This is the program file which implements the spider class to:
@@ -9,61 +9,57 @@ This is the program file which implements the spider class to:
 */
 
 #include "Spider.h"
+#include <cmath>
+#include <cstdio>
 
-Spider::Spider(RenderWindow* window)
+Spider::Spider(float screenWidth, float screenHeight, Random* random)
+{
+    //saving the random generator
+    m_Random = random;
+
+    //initialize screen size
+    m_ScreenWidth = screenWidth;
+    m_ScreenHeight = screenHeight;
+    m_MaxHeight = m_ScreenHeight - 0.3f * m_ScreenHeight; //only be able to move up about 30% of the screen
+
+    //starting off the screen
+    reset();
+}
+
+void Spider::reset()
 {
     //set the initial x,y of the spider to off the string until alive
     m_Position.x = -100;
     m_Position.y = 0;
 
-    //initialize the shape size and position
-    m_Shape.setSize(sf::Vector2f(m_Width, m_Height));
-    m_Shape.setPosition(m_Position);
+    //initialize the bounds size and position
+    m_Bounds = Bounds(m_Position.x, m_Position.y, m_Width, m_Height);
+    m_TickStartPosition = m_Position;
 
-    //set the texture and sprite
-    //debugging texture loading issues
-    std::string imagePath = "graphics/Spider.png";
-    #ifdef DEBUG
-    //debug printing the path
-    printf("Attempting to load image from: %s\n", imagePath);
-    #endif
-    if (!m_SpiderImage.loadFromFile(imagePath))
-    { //image wasn't loaded, throw an error by setting spider to purple
-        m_Shape.setFillColor(Color(100, 40, 100));
-        m_Shape.setOutlineThickness(1);
-    }
-    else
-    { //image successfully loaded, set the ship texture to be an image
-        m_Sprite.setTexture(m_SpiderImage);
-        m_Shape.setOutlineThickness(0);
-    }
-    m_Sprite.setPosition(m_Position);
-   
-    //initialize the window for drawing
-    m_Window = window;
-    
-    //initialize screen size
-    m_ScreenWidth = (float) m_Window->getSize().x;
-    m_ScreenHeight = (float) m_Window->getSize().y;
-    m_MaxHeight = m_ScreenHeight - 0.3f * m_ScreenHeight; //only be able to move up about 30% of the screen
+    //not alive (or worth anything) until it spawns
+    m_DesiredX = 1;
+    m_Time = 0;
+    m_Health = 0;
+    m_Points = 0;
 }
 
-FloatRect Spider::getPosition()
+Vec2 Spider::getInterpolatedPosition(float alpha) const
 {
-    //return the shape position
-    return m_Shape.getGlobalBounds();
+    //returning the position between the start and end of the last update
+    return Vec2::lerp(m_TickStartPosition, Vec2(m_Bounds.left, m_Bounds.top), alpha);
 }
 
-RectangleShape Spider::getShape()
+Bounds Spider::getSweptPosition() const
 {
-    //return the shape
-    return m_Shape;
+    //returning the area from the start of the last update to the current bounds
+    Bounds start(m_TickStartPosition.x, m_TickStartPosition.y, m_Bounds.width, m_Bounds.height);
+    return start.sweptArea(getMovement());
 }
 
-int Spider::checkDamage(FloatRect other, int damage)
+int Spider::checkDamage(Bounds other, int damage)
 {
     //check if they intersect. If so, do damage or react
-    FloatRect intersection;
+    Bounds intersection;
     if (other.intersects(this->getPosition(), intersection))
     { 
         //objects intersects, check collision response
@@ -134,7 +130,7 @@ float Spider::changeDirectionAbsolute(float directX, float directY, float prevX,
             directX *= -1; //change direction of the x to be opposite of avoidance
 
             //randomly set y to be -1, 0, or 1
-            float random = ((float) std::rand()) / RAND_MAX; //random 0 to 1
+            float random = m_Random->nextFloat(); //random 0 to 1
             directY = (random < .33f) ? -1.0f : ((random < .66f) ? 0 : 1.0f); //change direction of y to be random -1, 0, or 1
         }
         else if (directY != 0)
@@ -143,33 +139,33 @@ float Spider::changeDirectionAbsolute(float directX, float directY, float prevX,
             directY *= -1; //change direction of the y to be opposite of avoidance
 
             //randomly set x to be -1, 0, 1 or 50% of the time towards the player
-            float random = ((float) std::rand()) / RAND_MAX; //random 0 to 1
+            float random = m_Random->nextFloat(); //random 0 to 1
 	        if (random <= .5f)
 	        { //go with desired X 50% of the time to go toward the player more
-	            directX = abs(m_DesiredX)/m_DesiredX;
+	            directX = std::abs(m_DesiredX)/m_DesiredX;
 	        }
 	        else
 	        { //otherwise, randomly choose -1, 0, or 1
-	            random = ((float) std::rand()) / RAND_MAX; //random 0 to 1
+	            random = m_Random->nextFloat(); //random 0 to 1
 	            directX = (random < .33f) ? -1.0f : ( (random < .66f) ? 0.0f : 1.0f ); //change direction of x to be random -1, 0, or 1
 	        }
         }
         else
         { //don't have to avoid any direction, no hit.  Just choose a random direction.
             //randomly set x to be -1, 0, 1, or 50% of the time towards the  player
-            float random = ((float) std::rand()) / RAND_MAX; //random 0 to 1
+            float random = m_Random->nextFloat(); //random 0 to 1
             if (random < .5f)
 	        { //go with desired X 50% of the time to go toward the player more
-	            directX = abs(m_DesiredX)/m_DesiredX;
+	            directX = std::abs(m_DesiredX)/m_DesiredX;
 	        }
 	        else
 	        { //otherwise, randomly choose -1, 0, or 1
-	            random = ((float) std::rand()) / RAND_MAX; //random 0 to 1
+	            random = m_Random->nextFloat(); //random 0 to 1
 	            directX = (random < .33f) ? -1.0f : ( (random < .66f) ? 0.0f : 1.0f ); //change direction of x to be random -1, 0, or 1
 	        }
             
             //randomly set y to be -1, 0, or 1
-            random = ((float) std::rand()) / RAND_MAX; //random 0 to 1
+            random = m_Random->nextFloat(); //random 0 to 1
             directY = (random < .33f) ? -1.0f : ((random < .66f) ? 0 : 1.0f); //change direction of y to be random -1, 0, or 1
         }
     }
@@ -196,7 +192,7 @@ void Spider::changeDirectionBound(float boundX, float boundY)
         directX = -boundX;
 
         //randomly define Y to be -1, 0, or 1
-        float random = ((float) std::rand()) / RAND_MAX; //random 0 to 1
+        float random = m_Random->nextFloat(); //random 0 to 1
         directY = (random < .33f) ? -1.0f : ( (random < .66f) ? 0.0f : 1.0f ); //change direction of y to be random -1, 0, or 1
     }
     else
@@ -205,14 +201,14 @@ void Spider::changeDirectionBound(float boundX, float boundY)
         directY = -boundY;
 
         //randomly define X to be -1, 0, or 1
-        float random = ((float) std::rand()) / RAND_MAX; //random 0 to 1
+        float random = m_Random->nextFloat(); //random 0 to 1
         if (random < .5f)
 	    { //go with desired X 50% of the time to go toward the player more
-	        directX = abs(m_DesiredX)/m_DesiredX;
+	        directX = std::abs(m_DesiredX)/m_DesiredX;
 	    }
         else
         { //otherwise, randomly choose -1, 0, or 1
-	        random = ((float) std::rand()) / RAND_MAX; //random 0 to 1
+	        random = m_Random->nextFloat(); //random 0 to 1
 	        directX = (random < .33f) ? -1.0f : ( (random < .66f) ? 0.0f : 1.0f ); //change direction of x to be random -1, 0, or 1
 	    }
     }
@@ -224,8 +220,8 @@ void Spider::changeDirectionBound(float boundX, float boundY)
 float Spider::changeDirection(float directX, float directY, bool createVector)
 {
     return Spider::changeDirectionAbsolute(
-        directX, directY, (m_DirectionX == 0) ? 0 : abs(m_DirectionX)/m_DirectionX,
-        (m_DirectionY == 0) ? 0 : abs(m_DirectionY)/m_DirectionY, createVector
+        directX, directY, (m_DirectionX == 0) ? 0 : std::abs(m_DirectionX)/m_DirectionX,
+        (m_DirectionY == 0) ? 0 : std::abs(m_DirectionY)/m_DirectionY, createVector
         );
 }
 
@@ -243,7 +239,7 @@ void Spider::startMovement()
 { //randomly choose left vs right size and height level / up/down direction to start with
     // Initializing spider variables
     m_Health = 1;
-    m_Speed = floor((((float) std::rand()) / RAND_MAX) * 3.0f + 4.0f);
+    m_Speed = floor((m_Random->nextFloat()) * 3.0f + 4.0f);
     m_Points = 300 + (int) floor((m_Speed - 4.f) * 200.f);
     m_Speed *= 60.0f;
     #ifdef DEBUG
@@ -251,7 +247,7 @@ void Spider::startMovement()
     #endif
 
     //getting the random float to generate left vs right and height
-    float random = ((float) std::rand()) / RAND_MAX; //random 0 to 1
+    float random = m_Random->nextFloat(); //random 0 to 1
     if (random >= .5f)
     { //generate on the right edge
         //get the relative height value
@@ -285,51 +281,22 @@ void Spider::startMovement()
         m_Position.x = -80;
     }
 
+    //jump straight to the starting position (don't slide in from the last spot when drawing)
+    m_Bounds.setPosition(m_Position);
+    m_TickStartPosition = m_Position;
+
     #ifdef DEBUG
     printf("Starting spider values: P(%f, %f), D(%f, %f), S:%f\n", m_Position.x, m_Position.y, m_DirectionX, m_DirectionY, m_Speed);
     #endif
 }
 
-int Spider::getHealth()
-{
-    //returning the current spider health
-    return m_Health;
-}
-
-int Spider::getPoints()
-{
-    //return how many points the spider is worth
-    return m_Points;
-}
-
 void Spider::doDamage(int damage)
 {
     //do damage value given
     m_Health -= damage;
 }
 
-void Spider::draw()
-{
-    //don't draw the spider if dead
-    if (m_Health <= 0)
-    { //spider is dead, don't draw it
-        return;
-    }
-  
-    //draw the spider if loaded
-    if (m_Shape.getOutlineThickness() == 1)
-    {
-        //image didn't load, draw the purple square
-        m_Window->draw(m_Shape);
-    }
-    else
-    {
-        //image loaded, draw the sprite
-        m_Window->draw(m_Sprite);
-    }
-}
-
-bool Spider::update(Time dt, float shipX)
+bool Spider::update(float dt, float shipX)
 {
     // Making sure the Spider is alive
     if (m_Health <= 0)
@@ -339,9 +306,10 @@ bool Spider::update(Time dt, float shipX)
     }
     
     // Update the spider location based on the unit vector direction
+    m_TickStartPosition = Vec2(m_Bounds.left, m_Bounds.top);
     //move the Spider
-    m_Position.x += m_DirectionX * m_Speed * dt.asSeconds();
-    m_Position.y += m_DirectionY * m_Speed * dt.asSeconds();
+    m_Position.x += m_DirectionX * m_Speed * dt;
+    m_Position.y += m_DirectionY * m_Speed * dt;
 
     //update the desired direction
     m_DesiredX = (m_Position.x > shipX) ? -1.f : 1.f;
@@ -374,12 +342,11 @@ bool Spider::update(Time dt, float shipX)
     }
 
     // Saving current position
-    m_Time += dt.asMilliseconds();
+    m_Time += dt * 1000.0f;
     m_PrevPosition = m_Position;
 
     // Move the spider
-    m_Shape.setPosition(m_Position);
-    m_Sprite.setPosition(m_Position);
+    m_Bounds.setPosition(m_Position);
 
     // Returning that the spider still exists
     return (m_Health != 0);
@@ -1,6 +1,6 @@
 /*
 Author: Dawson Pent
-Last Date Modified: 9/29/24
+Last Date Modified: 10/17/26
 
 Description:
 This is the header file which describes the spider class to:
@@ -9,36 +9,35 @@ This is the header file which describes the spider class to:
 */
 
 #pragma once
-#include <SFML/Graphics.hpp>
-
-using namespace sf;
+#include "Geometry.h"
+#include "Random.h"
+#include <type_traits>
 
 class Spider
 {
 private:
     //creating necessary objects for the location/shape
-    Vector2f m_Position;
-    Vector2f m_PrevPosition;
-    RectangleShape m_Shape;
-    Texture m_SpiderImage;
-    Sprite m_Sprite;
-    RenderWindow *m_Window;
+    Vec2 m_Position;
+    Vec2 m_PrevPosition;
+    Bounds m_Bounds;
+    Random *m_Random; //the world's random generator to pick directions and speeds with
+    Vec2 m_TickStartPosition; //where the spider was drawn before the last update
 
     //setting constant values for the object
-    const float m_Width = 60;
-    const float m_Height = 40;
+    static constexpr float m_Width = 60;
+    static constexpr float m_Height = 40;
 
-    const int m_Damage = 3;
+    static constexpr int m_Damage = 3;
 
-    const int m_PointsBase = -100;
-    const int m_PointsPerSpeed = 100;
+    static constexpr int m_PointsBase = -100;
+    static constexpr int m_PointsPerSpeed = 100;
 
     //creating changing values for the object
     float m_Speed; //movement speed of the spider
-    float m_DesiredX; //direction that the spider wants to go more towards
+    float m_DesiredX = 1; //direction that the spider wants to go more towards
     float m_DirectionX; //unit vector direction for x movement (-1, -.707 0, .707, or 1)
     float m_DirectionY; //unit vector for y direction
-    int m_Time = 0; //holds the time since the last movement to allow random, no-hit movement
+    float m_Time = 0; //holds the time since the last movement to allow random, no-hit movement
 
     int m_Health = 0; //identifies whether the spider is alive/active or not
     int m_Points = 0; //variable depending on the speed
@@ -64,9 +63,16 @@ public:
      * Constructor for the Spider class to create the spider object.
      * 
      * Parameters:
-     * @param window - pointer to the window which is displaying the game to draw the spider
+     * @param screenWidth - the logical width of the playing field the spider moves within
+     * @param screenHeight - the logical height of the playing field the spider moves within
+     * @param random - pointer to the world's random generator for the spider's movement choices
      */
-    Spider(RenderWindow* window);
+    Spider(float screenWidth, float screenHeight, Random* random);
+
+    /**
+     * Function to take the spider off the screen for a new round (it is reused in place and spawns again later).
+     */
+    void reset();
 
 
   
@@ -76,17 +82,36 @@ public:
      * Function to simply return the bounds (position and shape) of the object.
      * 
      * Returns:
-     * @param rectangle bounds of the object at the correct location and same size
+     * @return reference to the rectangle bounds of the object (kept up to date only when it moves)
      */
-    FloatRect getPosition();
+    const Bounds& getPosition() const { return m_Bounds; }
 
     /**
-     * Function to simply return the shape of the object.
+     * Function to get where to draw the object between its last two updates so motion stays smooth at any refresh rate.
      * 
+     * Parameters:
+     * @param alpha - how far between the previous update (0) and the latest update (1) to draw the object
+     *
+     * Returns:
+     * @return top left position to draw the object at
+     */
+    Vec2 getInterpolatedPosition(float alpha) const;
+
+    /**
+     * Function to simply get how far the object moved during its last update.
+     *
+     * Returns:
+     * @return the movement from the start to the end of the last update
+     */
+    Vec2 getMovement() const { return Vec2(m_Bounds.left, m_Bounds.top) - m_TickStartPosition; }
+
+    /**
+     * Function to get the area the object covered during its last update (for looking up what it may have passed through).
+     *
      * Returns:
-     * @return rectangle shape of the object
+     * @return the bounds box around the object's whole last movement
      */
-    RectangleShape getShape();
+    Bounds getSweptPosition() const;
 
   
 
@@ -141,7 +166,7 @@ public:
      * Returns:
      * @return the current health value of the spider
      */
-    int getHealth();
+    int getHealth() const { return m_Health; }
 
     /**
      * Function to simply get the number of points the spider is worth, variable to the speed:
@@ -153,7 +178,7 @@ public:
      * Returns:
      * @return the amount of points the spider is worth
      */
-    int getPoints();
+    int getPoints() const { return m_Points; }
 
     /**
      * Function to simply do a certain amount of damage to the spider
@@ -179,22 +204,21 @@ public:
      * Returns:
      * @return value of how much damage to do to the other object (-1 means no collision occured)
      */
-    int checkDamage(FloatRect other, int damage);
+    int checkDamage(Bounds other, int damage);
 
     /**
      * Function to update the positions and values of the spider based on movment direction vector and timing.
      * 
      * Parameters:
-     * @param dt - how long it has been since clock cycles to move the object accordingly far
+     * @param dt - how long it has been (in seconds) since the last update to move the object accordingly far
      * @param shipX - what the ship's x position is so that the spider can generally be closer to the player
      *
      * Returns:
      * @return whether the spider is still alive or not
      */
-    bool update(Time dt, float shipX);
-
-    /**
-     * Function to draw the spider at the current position values
-     */
-    void draw();
+    bool update(float dt, float shipX);
 };
+
+//keeping the spider small and plain to copy (the spider is reset in place every round and read every step)
+static_assert(sizeof(Spider) <= 96, "Spider grew past its size budget");
+static_assert(std::is_trivially_copyable<Spider>::value, "Spider must stay trivially copyable");
@@ -1,6 +1,6 @@
 /*
 Author: Dawson Pent
-Last Date Modified: 9/25/24
+Last Date Modified: 10/17/26
 
 Description:
 This is the program file which implements the starship class to:
@@ -8,70 +8,52 @@ This is the program file which implements the starship class to:
    key inputs gathered in game to move the starship.
  - Detect collisions between objects to kill the starship
  - Store the starship values of health (lives left)
+ - Fire lasers from the world's laser pool while shooting
 */
 
 #include "StarShip.h"
 
 // This the constructor function for the ship
-StarShip::StarShip(float X, float startY, RenderWindow* window)
+StarShip::StarShip(float X, float startY, float screenWidth, float screenHeight, LaserPool* lasers)
 {
-    //set the x and initial Y based on starship
-    m_Position.x = X;
-    m_Position.y = startY;
-
-    //initialize the laser array
-    for (int i = 0; i < m_ShotNum; ++i)
-    {
-        new(&shots[i]) Laser();
-    }
+    //saving the pool to shoot from
+    m_Lasers = lasers;
 
-    //initialize the shape size and position
-    m_Shape.setSize(sf::Vector2f(m_Width, m_Height));
-    m_Shape.setPosition(m_Position);
-
-    // Set the texture and sprite
-    //debugging texture loading issues
-    std::string imagePath = "graphics/StarShip.png";
-    #ifdef DEBUG
-    //debug printing the path
-    printf("Attempting to load image from: %s\n", imagePath);
-    #endif
-    if (!m_ShipImage.loadFromFile(imagePath))
-    {
-        //image wasn't loaded, set the ship to a purple rectangle
-        m_Shape.setFillColor(Color(200, 40, 200));
-        m_Shape.setOutlineThickness(1);
-    }
-    else
-    {
-        //image successfully loaded, set the ship texture to be an image
-        m_Sprite.setTexture(m_ShipImage);
-        m_Shape.setOutlineThickness(0);
-    }
-    m_Sprite.setPosition(0, 0);
-   
-    //initialize the window for drawing
-    m_Window = window;
-    
     //initialize screen size
-    m_ScreenWidth = (float) m_Window->getSize().x;
-    m_ScreenHeight = (float) m_Window->getSize().y;
+    m_ScreenWidth = screenWidth;
+    m_ScreenHeight = screenHeight;
     m_MaxHeight = m_ScreenHeight - 0.3f * m_ScreenHeight; //only be able to move up about 30% of the screen
+
+    //set the x and initial Y based on starship
+    reset(X, startY);
 }
 
-FloatRect StarShip::getPosition()
+void StarShip::reset(float startX, float startY)
 {
-    //return the shape position
-    return m_Shape.getGlobalBounds();
+    //set the x and initial Y based on starship
+    m_Position.x = startX;
+    m_Position.y = startY;
+
+    //initialize the bounds size and position
+    m_Bounds = Bounds(m_Position.x, m_Position.y, m_Width, m_Height);
+    m_TickStartPosition = m_Position;
+
+    //letting go of every key and the shot delay
+    m_Shooting = false;
+    m_CurrentShootDelay = 0;
+    m_Left = 0;
+    m_Right = 0;
+    m_Up = 0;
+    m_Down = 0;
 }
 
-RectangleShape StarShip::getShape()
+Vec2 StarShip::getInterpolatedPosition(float alpha) const
 {
-    //return the shape
-    return m_Shape;
+    //returning the position between the start and end of the last update
+    return Vec2::lerp(m_TickStartPosition, Vec2(m_Bounds.left, m_Bounds.top), alpha);
 }
 
-int StarShip::checkDamage(FloatRect other)
+int StarShip::checkDamage(Bounds other)
 {
     //check if they intersect. If so, do damage
     if (other.intersects(this->getPosition()))
@@ -114,6 +96,7 @@ void StarShip::undoMove()
     //some kind of conflict with movement arose, undo the movement
     m_Position.x = m_PrevPosition.x;
     m_Position.y = m_PrevPosition.y;
+    m_Bounds.setPosition(m_Position);
 }
 
 void StarShip::shoot(bool active)
@@ -122,15 +105,10 @@ void StarShip::shoot(bool active)
     m_Shooting = active;
 }
 
-Laser* StarShip::getLaserArray() {
-    //returning the pointer to the laser array
-    return shots;
-}
-
-int StarShip::getHealth()
+LaserPool& StarShip::getLasers()
 {
-    //returning the current ship health
-    return m_Health;
+    //returning the laser pool
+    return *m_Lasers;
 }
 
 void StarShip::setHealth(int health)
@@ -138,61 +116,32 @@ void StarShip::setHealth(int health)
   m_Health = health;
 }
 
-void StarShip::draw()
-{
-    //first draw the ship
-    if (m_Shape.getOutlineThickness() == 1)
-    {
-        //image didn't load, draw the purple square
-        m_Window->draw(m_Shape);
-    }
-    else
-    {
-        //image loaded, draw the sprite
-        m_Window->draw(m_Sprite);
-    }
-    
-    //now draw all of the lasers
-    for (Laser shot : shots)
-    {
-        if (shot.getHealth() == 0)
-        {
-            //skip drawing if not a live shot
-            continue;
-        }
-        m_Window->draw(shot.getShape());
-    }
-}
-
-bool StarShip::update(Time dt)
+bool StarShip::update(float dt)
 {
     // Updating the shots
     //shoot if you can
     if (m_Shooting && m_CurrentShootDelay <= 0)
-    { //starting the current shot so it shoots off as a laser
-        shots[m_CurrentShot].startLaser(m_Position.x + m_Width/2 - 2, m_Position.y);
-        m_CurrentShot = (++m_CurrentShot < m_ShotNum) ? m_CurrentShot : 0;
+    { //firing the next free laser (no shot comes out if every laser is already in flight)
+        m_Lasers->fire(m_Position.x + m_Width/2 - 2, m_Position.y);
         m_CurrentShootDelay = m_ShootDelay;
     }
     //decrement shoot delay so we can shoot the next one fast until it hits 0
     if (m_CurrentShootDelay > 0)
     {
-        m_CurrentShootDelay = m_CurrentShootDelay - dt.asSeconds();
+        m_CurrentShootDelay = m_CurrentShootDelay - dt;
     }
     
-    //update all of the shots
-    for (int i = 0; i < m_ShotNum; ++i)
-    {
-        shots[i].update(dt);
-    }
+    //update all of the shots in flight
+    m_Lasers->update(dt);
 
 	// Update the ship location based on direction
     //save the current position
+    m_TickStartPosition = Vec2(m_Bounds.left, m_Bounds.top);
     m_PrevPosition.x = m_Position.x;
     m_PrevPosition.y = m_Position.y;
     //move the ship
-    m_Position.x += (m_Left + m_Right) * m_Speed * dt.asSeconds();
-    m_Position.y += (m_Up + m_Down) * m_Speed * dt.asSeconds();
+    m_Position.x += (m_Left + m_Right) * m_Speed * dt;
+    m_Position.y += (m_Up + m_Down) * m_Speed * dt;
 
     // Ensuring the positions aren't out of bounds
     if (m_Position.x < 15)
@@ -217,8 +166,7 @@ bool StarShip::update(Time dt)
     }
 
     // Move the ship
-    m_Shape.setPosition(m_Position);
-    m_Sprite.setPosition(m_Position);
+    m_Bounds.setPosition(m_Position);
 
     // Returning that the laser still exists
     return (m_Health != 0);
@@ -1,6 +1,6 @@
 /*
 Author: Dawson Pent
-Last Date Modified: 9/25/24
+Last Date Modified: 10/17/26
 
 Description:
 This is the header file which describes the starship class to:
@@ -8,38 +8,34 @@ This is the header file which describes the starship class to:
    key inputs gathered in game to move the starship.
  - Detect collisions between objects to kill the starship
  - Store the starship values of health (lives left)
+ - Fire lasers from the world's laser pool while shooting
 */
 
 #pragma once
-#include <SFML/Graphics.hpp>
-#include "LaserBlast.h"
-
-using namespace sf;
+#include "Geometry.h"
+#include "LaserPool.h"
+#include <type_traits>
 
 class StarShip
 {
 private:
     //creating necessary objects for the location/shape
-	Vector2f m_Position;	
-    Vector2f m_PrevPosition;
-	RectangleShape m_Shape;
-    Texture m_ShipImage;
-    Sprite m_Sprite;
-    RenderWindow *m_Window;
+	Vec2 m_Position;	
+    Vec2 m_PrevPosition;
+	Bounds m_Bounds;
+    Vec2 m_TickStartPosition; //where the ship was drawn before the last update
 
     //setting constant values for the object
-	const float m_Speed = 600.0f;
-    const int m_Damage = 7;
+	static constexpr float m_Speed = 600.0f;
+    static constexpr int m_Damage = 7;
 
-    const float m_Width = 20;
-    const float m_Height = 30;
+    static constexpr float m_Width = 20;
+    static constexpr float m_Height = 30;
 
-    const static int m_ShotNum = 30;
-    const float m_ShootDelay = 0.1f;
+    static constexpr float m_ShootDelay = 0.1f;
 
     //creating changing values for the object
-    Laser shots[m_ShotNum];
-    int m_CurrentShot = 0;
+    LaserPool* m_Lasers; //where the ship's lasers come from (owned by the world so its memory is kept between rounds)
     bool m_Shooting = false;
     float m_CurrentShootDelay = 0;
 
@@ -61,9 +57,21 @@ public:
      * Parameters:
      * @param startX - this is a float which identifies the starting x position of the ship
      * @param startY - this is a float which identifies the starting y position of the ship
-     * @param window - this is a pointer to the game's window object to draw the star ship and lasers
+     * @param screenWidth - the logical width of the playing field to keep the ship within
+     * @param screenHeight - the logical height of the playing field to keep the ship within
+     * @param lasers - pointer to the pool to fire the ship's lasers from
+     */
+    StarShip(float startX, float startY, float screenWidth, float screenHeight, LaserPool* lasers);
+
+    /**
+     * Function to put the ship back at a starting position for a new round, with no keys held and no shot cooling down.
+     *  The ship is reused in place between rounds (the health is set separately).
+     * 
+     * Parameters:
+     * @param startX - the x position to start the ship at
+     * @param startY - the y position to start the ship at
      */
-    StarShip(float startX, float startY, RenderWindow* window);
+    void reset(float startX, float startY);
 
 
   
@@ -73,17 +81,20 @@ public:
      * Function to simply return the bounds (position and shape) of the object.
      * 
      * Returns:
-     * @return rectangle bounds of the object at the correct location and same size
+     * @return reference to the rectangle bounds of the object (kept up to date only when it moves)
      */
-    FloatRect getPosition();
+    const Bounds& getPosition() const { return m_Bounds; }
 
     /**
-     * Function to simply return the shape of the object.
+     * Function to get where to draw the object between its last two updates so motion stays smooth at any refresh rate.
      * 
+     * Parameters:
+     * @param alpha - how far between the previous update (0) and the latest update (1) to draw the object
+     *
      * Returns:
-     * @return rectangle shape of the object
+     * @return top left position to draw the object at
      */
-    RectangleShape getShape();
+    Vec2 getInterpolatedPosition(float alpha) const;
 
 
   
@@ -143,7 +154,7 @@ public:
      * Returns:
      * @return current integer value of the health of the ship
      */
-    int getHealth();
+    int getHealth() const { return m_Health; }
   
     /**
      * Function to set the new health of the ship
@@ -154,17 +165,12 @@ public:
     void setHealth(int health);
 
     /**
-     * Function to get the pointer to the ship's laser array for hit detection.
+     * Function to get the pool of the ship's lasers (its active list is every laser in flight) for hit detection and drawing.
      * 
      * Returns:
-     * @return pointer to the ship's laser array
-     */
-    Laser* getLaserArray();
-
-    /**
-     * Function to draw the ship and its lasers at the current position values
+     * @return reference to the laser pool
      */
-    void draw();
+    LaserPool& getLasers();
 
 
   
@@ -180,16 +186,20 @@ public:
      * Returns:
      * @return value of how much damage to do to the other object (-1 means no collision occured)
      */
-    int checkDamage(FloatRect other);
+    int checkDamage(Bounds other);
 
     /**
-     * Function to update the positions and values of the ship including the lasers in the laser array based on user input and timing.
+     * Function to update the positions and values of the ship including the lasers in flight based on user input and timing.
      * 
      * Parameters:
-     * @param dt - how long it has been since clock cycles to move the object accordingly far
+     * @param dt - how long it has been (in seconds) since the last update to move the object accordingly far
      *
      * Returns:
      * @return whether the ship is still alive or not
      */
-    bool update(Time dt);
+    bool update(float dt);
 };
+
+//keeping the ship small and plain to copy (the ship is reset in place every round and read every step)
+static_assert(sizeof(StarShip) <= 96, "StarShip grew past its size budget");
+static_assert(std::is_trivially_copyable<StarShip>::value, "StarShip must stay trivially copyable");
@@ -0,0 +1,116 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the program file which implements the trace writer class to:
+ - Write timed slices (frames, zones, asset loads) and instant marks (round changes) as Chrome / Perfetto trace-event JSON
+ - Buffer the events in memory and write them on a background thread so tracing doesn't cause frame spikes itself
+*/
+
+#include "TraceWriter.h"
+
+TraceWriter::~TraceWriter()
+{
+    close();
+}
+
+bool TraceWriter::open(const std::string& path)
+{
+    //creating the file and starting the JSON
+    close();
+    m_File = std::fopen(path.c_str(), "w");
+    if (m_File == nullptr)
+    {
+        return false;
+    }
+    std::fprintf(m_File, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    std::fprintf(m_File, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"game loop\"}}");
+    m_FirstEvent = false;
+    m_Start = std::chrono::steady_clock::now();
+
+    //starting the writer thread
+    m_Stopping = false;
+    m_Thread = std::thread(&TraceWriter::writeLoop, this);
+    return true;
+}
+
+bool TraceWriter::isOpen()
+{
+    return m_File != nullptr;
+}
+
+void TraceWriter::submit(std::vector<TraceEvent>& events)
+{
+    //moving the events to the pending buffer (only held for the copy)
+    if (m_File != nullptr && !events.empty())
+    {
+        std::lock_guard<std::mutex> guard(m_Lock);
+        m_Pending.insert(m_Pending.end(), events.begin(), events.end());
+    }
+    events.clear();
+}
+
+void TraceWriter::writeLoop()
+{
+    std::unique_lock<std::mutex> guard(m_Lock);
+    while (true)
+    {
+        //waiting until it is time to write or the writer is closing
+        bool stopping = m_Wake.wait_for(guard, std::chrono::milliseconds(m_FlushMilliseconds), [this] { return m_Stopping; });
+
+        //swapping out the pending events and writing them without holding the lock
+        m_Writing.swap(m_Pending);
+        guard.unlock();
+        writeEvents(m_Writing);
+        m_Writing.clear();
+        guard.lock();
+
+        if (stopping && m_Pending.empty())
+        {
+            return;
+        }
+    }
+}
+
+void TraceWriter::writeEvents(const std::vector<TraceEvent>& events)
+{
+    for (const TraceEvent& event : events)
+    {
+        //timestamps are microseconds since the trace started
+        double start = std::chrono::duration<double, std::micro>(event.start - m_Start).count();
+        std::fprintf(m_File, "%s\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":1",
+            m_FirstEvent ? "" : ",", event.name, event.category, event.phase, start);
+        if (event.phase == 'X')
+        { //slices have a duration
+            std::fprintf(m_File, ",\"dur\":%.3f}", std::chrono::duration<double, std::micro>(event.end - event.start).count());
+        }
+        else
+        { //instant marks are drawn across the thread
+            std::fprintf(m_File, ",\"s\":\"t\"}");
+        }
+        m_FirstEvent = false;
+    }
+}
+
+void TraceWriter::close()
+{
+    //ensuring there is something to close
+    if (m_File == nullptr)
+    {
+        return;
+    }
+
+    //stopping the writer thread once it has written everything
+    {
+        std::lock_guard<std::mutex> guard(m_Lock);
+        m_Stopping = true;
+    }
+    m_Wake.notify_one();
+    m_Thread.join();
+
+    //finishing the JSON
+    std::fprintf(m_File, "\n]}\n");
+    std::fclose(m_File);
+    m_File = nullptr;
+}
@@ -0,0 +1,101 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the trace writer class to:
+ - Write timed slices (frames, zones, asset loads) and instant marks (round changes) as Chrome / Perfetto trace-event JSON
+ - Buffer the events in memory and write them on a background thread so tracing doesn't cause frame spikes itself
+Open the written file in chrome://tracing or ui.perfetto.dev to see the slices nested under every frame.
+*/
+
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// A single event of the trace (names must be string literals or otherwise outlive the writer)
+struct TraceEvent
+{
+    const char* name;
+    const char* category;
+    char phase; //'X' for a slice with a duration, 'i' for an instant mark
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point end;
+};
+
+class TraceWriter
+{
+private:
+    //creating necessary objects for writing
+    FILE* m_File = nullptr;
+    std::thread m_Thread;
+    std::mutex m_Lock;
+    std::condition_variable m_Wake;
+
+    //creating the event buffers (events are added to pending, the writer thread swaps them out to write)
+    std::vector<TraceEvent> m_Pending;
+    std::vector<TraceEvent> m_Writing;
+    bool m_Stopping = false;
+    bool m_FirstEvent = true;
+    std::chrono::steady_clock::time_point m_Start; //time 0 of the trace
+
+    //setting constant values for the writer
+    const int m_FlushMilliseconds = 100; //how often the writer thread writes out the pending events
+
+    /**
+     * Private function run by the writer thread to write out pending events until the writer is closed.
+     */
+    void writeLoop();
+
+    /**
+     * Private function to format and write a batch of events to the file.
+     *
+     * Parameters:
+     * @param events - the events to write
+     */
+    void writeEvents(const std::vector<TraceEvent>& events);
+
+public:
+    /**
+     * Destructor for the TraceWriter class which writes any remaining events and closes the file.
+     */
+    ~TraceWriter();
+
+    /**
+     * Function to create the trace file and start the writer thread.
+     *
+     * Parameters:
+     * @param path - where to write the trace
+     *
+     * Returns:
+     * @return whether the file could be created
+     */
+    bool open(const std::string& path);
+
+    /**
+     * Function to simply see whether a trace is being written
+     *
+     * Returns:
+     * @return whether the writer is open
+     */
+    bool isOpen();
+
+    /**
+     * Function to hand a batch of events to the writer thread.  The batch is emptied (keeping its memory) so it can be reused.
+     *
+     * Parameters:
+     * @param events - the events to write
+     */
+    void submit(std::vector<TraceEvent>& events);
+
+    /**
+     * Function to write every remaining event, finish the JSON, and close the file.
+     */
+    void close();
+};
@@ -0,0 +1,605 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the program file which implements the world class to:
+ - Hold every game object of a match (mushrooms, starship, spider, and centipede) without needing a window
+ - Step the game rules (movement, collisions, scoring, and round/life changes) from a plain logical width and height
+ - Let a front end (or a headless runner) read the state of the match to draw or measure it
+*/
+
+#include "World.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+World::World(float screenWidth, float screenHeight, uint64_t seed)
+	: m_Ship(screenWidth/2, screenHeight-50, screenWidth, screenHeight, &m_Lasers),
+	  m_Spider(screenWidth, screenHeight, &m_Random),
+	  m_Random(seed)
+{
+	//saving the screen width and height
+	m_ScreenWidth = screenWidth;
+	m_ScreenHeight = screenHeight;
+
+	//sizing the mushroom grid to the field
+	m_MushroomGrid.reset(screenWidth, screenHeight);
+	m_GridHits.reserve(16); //enough for every object at normal frame rates (only a laser swept over a long step needs more)
+
+	//letting only the moving objects that interact pair up in the broadphase
+	m_Broadphase.allowPair(LAYER_LASER, LAYER_SEGMENT);
+	m_Broadphase.allowPair(LAYER_LASER, LAYER_SPIDER);
+	m_Broadphase.allowPair(LAYER_SHIP, LAYER_SEGMENT);
+	m_Broadphase.allowPair(LAYER_SHIP, LAYER_SPIDER);
+}
+
+bool World::createNewShroom(float relativeX, float relativeY)
+{
+	//calculating the new position of the mushroom while keeping them in a grid
+	float positionX = relativeX * (m_ScreenWidth - 130) + 65;
+	positionX = ((int) (positionX / 35.0f)) * 35.0f;
+	float positionY = relativeY * (m_ScreenHeight - 265) + 130;
+	positionY = ((int) (positionY / 35.0f)) * 35.0f;
+
+	//placing the mushroom if its grid cell is free
+	return placeShroom(positionX, positionY);
+}
+
+bool World::createNewShroomExact(float exactX, float exactY)
+{
+	//ensuring the spot is on the field (a segment can be shot just off the left or top edge)
+	if (exactX < 0 || exactY < 0)
+	{
+		return false;
+	}
+
+	//force the position to be on the grid
+	float positionX = floor(exactX) - ((int) exactX % 35);
+	float positionY = floor(exactY) - ((int) exactY % 35);
+
+	//placing the mushroom if its grid cell is free
+	return placeShroom(positionX, positionY);
+}
+
+bool World::placeShroom(float positionX, float positionY)
+{
+	//ensuring the mushroom isn't overlapping with another one (mushrooms only overlap when they share a grid cell)
+	int column, row;
+	if (!m_MushroomGrid.getCell(positionX, positionY, column, row) || m_MushroomGrid.get(column, row) != -1)
+	{
+		//outside of the field or the cell was taken, mushroom creation unsuccessful
+		return false;
+	}
+
+	//no other mushroom was in the same location, place the mushroom and index it by its cell
+	int index = m_Mushrooms.add(positionX, positionY, m_Time);
+	m_MushroomGrid.set(column, row, index);
+	m_MushroomGrid.setHealth(column, row, m_Mushrooms.getHealth(index));
+
+	//return that it was successful
+	return true;
+}
+
+void World::removeShroom(SlotHandle handle)
+{
+	//ignoring mushrooms that were already removed
+	int index = m_Mushrooms.find(handle);
+	if (index == -1)
+	{
+		return;
+	}
+
+	//emptying the mushroom's cell
+	int column, row;
+	m_MushroomGrid.getCell(m_Mushrooms.getPosition(index).left, m_Mushrooms.getPosition(index).top, column, row);
+	m_MushroomGrid.set(column, row, -1);
+
+	//moving the last mushroom into its spot (so no other index changes) and pointing that mushroom's cell at it
+	int last = m_Mushrooms.size() - 1;
+	m_Mushrooms.remove(handle);
+	if (index != last)
+	{
+		m_MushroomGrid.getCell(m_Mushrooms.getPosition(index).left, m_Mushrooms.getPosition(index).top, column, row);
+		m_MushroomGrid.set(column, row, index);
+	}
+}
+
+void World::damageShroom(int index, int damage)
+{
+	//doing the damage, then moving the mushroom's cell to the band of its new health
+	m_Mushrooms.doDamage(index, damage, m_Time);
+	Bounds mushroom = m_Mushrooms.getPosition(index);
+	int column, row;
+	if (m_Mushrooms.getHealth(index) > 0 && m_MushroomGrid.getCell(mushroom.left, mushroom.top, column, row))
+	{
+		m_MushroomGrid.setHealth(column, row, m_Mushrooms.getHealth(index));
+	}
+}
+
+void World::beginMatch()
+{
+	PROFILE_ZONE(ZONE_BEGIN_MATCH);
+	//intitializing score to 0
+	m_Score = 0;
+
+	//empty whatever mushrooms are left in the vector (and the grid), and restart the match clock
+	m_Mushrooms.clear();
+	m_MushroomGrid.clear();
+	m_Time = 0;
+
+	//initializing all random mushrooms
+	int failedAttempts = 0;
+	for (int i = 0; i < m_StartingMushrooms; ++i)
+	{
+		//getting relative random positions (0f to 1f)
+		float relativeX = m_Random.nextFloat();
+		float relativeY = m_Random.nextFloat();
+
+		//creating the mushroom object
+		if (!createNewShroom(relativeX, relativeY))
+		{
+			//creation of the mushroom was unsuccessful (mushroom collision), stop if the field is full
+			if (++failedAttempts >= m_MaxShroomAttempts)
+			{
+				break;
+			}
+			i--;
+			continue;
+		}
+		failedAttempts = 0;
+	}
+
+	//starting the first round of the match
+	startRound(m_StartingLives);
+}
+
+void World::startRound(int health)
+{
+	PROFILE_ZONE(ZONE_START_ROUND);
+	//beginning the next round
+	m_Tick = 0; //initializing tick as 0
+	m_Lives = health;
+
+	//every object of a round is reset in place and every list keeps its memory, so starting a round (or a new life) never allocates
+	//resetting the starship with none of its lasers in flight
+	m_Lasers.clear();
+	m_Ship.reset(m_ScreenWidth/2, m_ScreenHeight-50);
+	m_Ship.setHealth(health);
+
+	//resetting the spider
+	m_Spider.reset();
+
+	//respawning the centipede as one chain (in the segments and chains the last round left behind)
+	m_Centipede.spawn(m_ScreenWidth, m_ScreenHeight, m_StartingSegments, m_Random);
+}
+
+void World::destroySegment(int order)
+{
+	//saving the spot for a mushroom
+	Bounds position = m_Centipede.getSegment(order)->getPosition();
+	m_SegmentShrooms.push_back(Vec2(position.left, position.top));
+
+	//shooting the segment out of its chain (splitting the chain if it was in the middle)
+	m_Centipede.destroy(order);
+}
+
+void World::setStartingCounts(int mushrooms, int segments)
+{
+	m_StartingMushrooms = (mushrooms > 0) ? mushrooms : 0;
+	m_StartingSegments = (segments > 2) ? segments : 2;
+}
+
+void World::setLaserCapacity(int capacity)
+{
+	m_Lasers.setCapacity(capacity);
+}
+
+StepResult World::step(float dt, Input input)
+{
+	//running the phases of the step in order
+	applyInput(input);
+	updateObjects(dt);
+	StepResult result = resolveCollisions(dt);
+
+	//counting the step and what is left alive for the performance HUD
+	PROFILE_COUNT(COUNTER_TICKS, 1);
+	PROFILE_SET(COUNTER_MUSHROOMS, (uint32_t) m_Mushrooms.size());
+	PROFILE_SET(COUNTER_SEGMENTS, (uint32_t) m_Centipede.getSegments().size());
+	return result;
+}
+
+void World::applyInput(Input input)
+{
+	// --- Applying player inputs --- //
+	m_Ship.moveLeft((input & ACTION_LEFT) != 0);
+	m_Ship.moveRight((input & ACTION_RIGHT) != 0);
+	m_Ship.moveUp((input & ACTION_UP) != 0);
+	m_Ship.moveDown((input & ACTION_DOWN) != 0);
+	m_Ship.shoot((input & ACTION_SHOOT) != 0);
+}
+
+void World::updateObjects(float dt)
+{
+	// --- Updating Objects --- //
+	PROFILE_ZONE(ZONE_UPDATE);
+	//updating the ship
+	{
+		PROFILE_ZONE(ZONE_UPDATE_SHIP);
+		m_Ship.update(dt);
+	}
+
+	//updating the spider
+	{
+		PROFILE_ZONE(ZONE_UPDATE_SPIDER);
+		m_Spider.update(dt, m_Ship.getPosition().left);
+	}
+
+	//updating the centipede movement
+	{
+		PROFILE_ZONE(ZONE_UPDATE_CENTIPEDE);
+		//each chain moves as a unit (its head steers, the rest follow its path)
+		m_Centipede.update(dt);
+	}
+
+	//every 100 ticks, random chance of spawning a spider if not already spawned
+	if (m_Tick%100 == 0 && m_Spider.getHealth() <= 0)
+	{
+		//random value from 0 to 1
+		float random = m_Random.nextFloat();
+		//if random value is greater than .8, spawn a new spider
+		if (random > .8f)
+		{
+			//spawning a new spider
+			m_Spider.startMovement();
+		}
+	}
+}
+
+StepResult World::resolveCollisions(float dt)
+{
+	// --- Checking for collisions --- //
+	PROFILE_ZONE(ZONE_COLLISION);
+	int numSegments = m_Centipede.getOrderCount();
+	int collisionTests = 0; //how many pairs of objects were tested this step (for the performance HUD)
+
+	//first check for mushroom collisions (only the mushrooms in the grid cells under each moving object are looked at)
+	int shotCount = m_Lasers.getActiveCount(); //only the lasers in flight are looked at
+	m_DeadShrooms.clear();
+
+	//check for any collisions between the ship and the mushrooms low enough to reach it
+	m_GridHits.clear();
+	m_MushroomGrid.query(m_Ship.getPosition(), m_GridHits);
+	for (int f = 0; f < (int) m_GridHits.size(); ++f)
+	{
+		Bounds mushroom = m_Mushrooms.getPosition(m_GridHits[f]);
+		if (mushroom.top >= 720) {
+			//getting if this mushroom collided with the ship
+			collisionTests++;
+			if (mushroom.intersects(m_Ship.getPosition()))
+			{
+				//ship collided, don't do damage, just undo movement
+				#ifdef DEBUG
+				printf("collision check:  S(%f, %f) || M(%f, %f)\n", m_Ship.getPosition().left,
+					m_Ship.getPosition().top, mushroom.left, mushroom.top);
+				#endif
+				m_Ship.undoMove();
+			}
+		}
+	}
+
+
+	//checking for any collisions between the spider and the mushrooms around it
+	m_GridHits.clear();
+	m_MushroomGrid.query(m_Spider.getPosition(), m_GridHits);
+	for (int f = 0; f < (int) m_GridHits.size(); ++f)
+	{
+		if (m_Mushrooms.getHealth(m_GridHits[f]) <= 0)
+		{
+			continue;
+		}
+		int collide = m_Spider.checkDamage(m_Mushrooms.getPosition(m_GridHits[f]), 0);
+		collisionTests++;
+		if (collide != -1)
+		{
+			//spider collided, already bounced, just slightly damage mushroom
+			damageShroom(m_GridHits[f], collide);
+			if (m_Mushrooms.getHealth(m_GridHits[f]) <= 0)
+			{
+				m_DeadShrooms.push_back(m_Mushrooms.getHandle(m_GridHits[f]));
+			}
+		}
+	}
+
+	//checking for any collisions between the centipede heads and the mushrooms they run into (the rest follow the heads' paths)
+	for (int c = 0; c < m_Centipede.getChainCount(); ++c)
+	{
+		Centipede& head = m_Centipede.getHead(c);
+		m_GridHits.clear();
+		m_MushroomGrid.query(head.getPosition(), m_GridHits);
+		for (int f = 0; f < (int) m_GridHits.size(); ++f)
+		{
+			if (m_Mushrooms.getHealth(m_GridHits[f]) > 0)
+			{
+				head.checkDamage(m_Mushrooms.getPosition(m_GridHits[f]), 0);
+				collisionTests++;
+			}
+		}
+	}
+
+
+	//sorting every moving object into the broadphase (ship, lasers, spider, then segments) to find which ones can touch
+	//lasers, the spider, and segments cover their whole movement this step so the swept checks can't miss a pair
+	//every laser uses the proxy of its slot in the pool, so ids don't shift as other lasers die and the order stays nearly sorted
+	int spiderProxy = m_Lasers.getCapacity() + 1;
+	int firstSegmentProxy = m_Lasers.getCapacity() + 2;
+	m_Broadphase.resize(firstSegmentProxy + numSegments);
+	m_Broadphase.setProxy(0, m_Ship.getPosition(), LAYER_SHIP);
+	for (int i = 0; i < m_Lasers.getFreeCount(); ++i)
+	{
+		m_Broadphase.setLayer(1 + m_Lasers.getFreeSlot(i), LAYER_NONE);
+	}
+	for (int i = 0; i < shotCount; ++i)
+	{
+		m_Broadphase.setProxy(1 + m_Lasers.getActiveSlot(i), m_Lasers.getActive(i).getSweptPosition(), LAYER_LASER);
+	}
+	m_Broadphase.setProxy(spiderProxy, m_Spider.getSweptPosition(), (m_Spider.getHealth() > 0) ? LAYER_SPIDER : LAYER_NONE);
+	//every segment uses the proxy of its place in the round's centipede, front to back (a shot hitting two at once takes the front one)
+	//shot segments' proxies were already taken out of the broadphase
+	for (int j = 0; j < numSegments; ++j)
+	{
+		Centipede* segment = m_Centipede.getSegment(j);
+		if (segment != nullptr)
+		{
+			m_Broadphase.setProxy(firstSegmentProxy + j, segment->getSweptPosition(), LAYER_SEGMENT);
+		}
+	}
+	m_Broadphase.update();
+	m_SegmentShrooms.clear();
+
+	//the pairs are sorted by their lower id, so the ship's pairs come first and then every laser's pairs together
+	const std::vector<BroadphasePair>& pairs = m_Broadphase.getPairs();
+	int shipPairs = 0;
+	while (shipPairs < (int) pairs.size() && pairs[shipPairs].first == 0)
+	{
+		shipPairs++;
+	}
+
+	//check every laser's whole movement this step against the mushrooms, spider, and centipede, and hit whichever it reached first
+	for (int i = 0; i < shotCount; ++i)
+	{
+		Laser& laser = m_Lasers.getActive(i);
+		Bounds shot = laser.getSweptPosition();
+		float firstTime = 2; //how far through the step the earliest hit happened (past the end until something is hit)
+		float time;
+		int shroom = -1;
+		int hitSegment = -1; //the order of the segment hit first (if one is)
+		bool spider = false;
+
+		// First check the mushrooms the shot passed over
+		m_GridHits.clear();
+		m_MushroomGrid.query(shot, m_GridHits);
+		for (int f = 0; f < (int) m_GridHits.size(); ++f)
+		{
+			//skipping mushrooms already destroyed this step
+			if (m_Mushrooms.getHealth(m_GridHits[f]) <= 0)
+			{
+				continue;
+			}
+			collisionTests++;
+			if (laser.sweep(m_Mushrooms.getPosition(m_GridHits[f]), Vec2(), time) && time < firstTime)
+			{
+				firstTime = time;
+				shroom = m_GridHits[f];
+			}
+		}
+
+		// Then check the spider and centipede segments the broadphase paired with the shot
+		int proxy = 1 + m_Lasers.getActiveSlot(i);
+		int pair = (int) (std::lower_bound(pairs.begin() + shipPairs, pairs.end(), proxy,
+			[](const BroadphasePair& found, int id) { return found.first < id; }) - pairs.begin());
+		for (; pair < (int) pairs.size() && pairs[pair].first == proxy; ++pair)
+		{
+			int other = pairs[pair].second;
+			if (other == spiderProxy)
+			{
+				//skipping the spider if an earlier shot already killed it this step
+				if (m_Spider.getHealth() <= 0)
+				{
+					continue;
+				}
+				collisionTests++;
+				if (laser.sweep(m_Spider.getPosition(), m_Spider.getMovement(), time) && time < firstTime)
+				{
+					firstTime = time;
+					spider = true;
+					shroom = -1;
+					hitSegment = -1;
+				}
+				continue;
+			}
+
+			//skipping segments an earlier shot already destroyed this step
+			Centipede* segment = m_Centipede.getSegment(other - firstSegmentProxy);
+			if (segment == nullptr)
+			{
+				continue;
+			}
+			collisionTests++;
+			if (laser.sweep(segment->getPosition(), segment->getMovement(), time) && time < firstTime)
+			{
+				firstTime = time;
+				hitSegment = other - firstSegmentProxy;
+				spider = false;
+				shroom = -1;
+			}
+		}
+
+		if (shroom != -1)
+		{
+			//bullet collided, hurt mushroom
+			Bounds mushroom = m_Mushrooms.getPosition(shroom);
+			int collide = laser.checkDamage(mushroom);
+			#ifdef DEBUG
+			printf("collision check %d:  L(%f, %f) || M(%f, %f)\n", collide, laser.getPosition().left,
+				laser.getPosition().top, mushroom.left, mushroom.top);
+			#endif
+			damageShroom(shroom, collide);
+			if (m_Mushrooms.getHealth(shroom) <= 0)
+			{
+				//mushroom has been destroyed by the player, increment score
+				m_Score += MushroomStore::getPoints();
+				m_DeadShrooms.push_back(m_Mushrooms.getHandle(shroom));
+			}
+		}
+		else if (spider)
+		{
+			//bullet collided, kill the spider and increment score
+			m_Spider.doDamage(laser.checkDamage(m_Spider.getPosition(), m_Spider.getMovement()));
+			m_Score += m_Spider.getPoints();
+		}
+		else if (hitSegment != -1)
+		{
+			//bullet collided, kill the centipede and increment score
+			Centipede* segment = m_Centipede.getSegment(hitSegment);
+			laser.checkDamage(segment->getPosition(), segment->getMovement());
+			m_Score += segment->getPoints();
+
+			//remove the segment right away (later shots and the ship skip it, and its proxy stays unused for the rest of the round)
+			m_Broadphase.setLayer(firstSegmentProxy + hitSegment, LAYER_NONE);
+			destroySegment(hitSegment);
+		}
+	}
+
+
+	// Next, check for player collisions
+	PROFILE_COUNT(COUNTER_COLLISION_TESTS, collisionTests + shipPairs);
+	bool spiderHit = false;
+	for (int p = 0; p < shipPairs; ++p)
+	{
+		//checking if spider has collided with the player starship
+		if (pairs[p].second == spiderProxy && m_Spider.getHealth() > 0 && m_Ship.checkDamage(m_Spider.getPosition()) != -1)
+		{
+			//spider has collided, kill spider and go to next round
+			m_Spider.doDamage(1);
+			spiderHit = true;
+		}
+	}
+	bool collision = spiderHit;
+	for (int p = 0; p < shipPairs && !spiderHit; ++p)
+	{
+		//checking for centipede collision (every segment that wasn't shot and touches the ship does damage)
+		int proxy = pairs[p].second - firstSegmentProxy;
+		Centipede* segment = (proxy >= 0) ? m_Centipede.getSegment(proxy) : nullptr;
+		if (segment != nullptr && m_Ship.checkDamage(segment->getPosition()) != -1)
+		{
+			collision = true;
+		}
+	}
+
+
+	//erasing the destroyed mushrooms (their handles find them wherever earlier removals moved them)
+	for (int d = 0; d < (int) m_DeadShrooms.size(); ++d)
+	{
+		removeShroom(m_DeadShrooms[d]);
+	}
+
+	//put a mushroom in every destroyed centipede segment's location
+	for (int d = 0; d < (int) m_SegmentShrooms.size(); ++d)
+	{
+		createNewShroomExact(m_SegmentShrooms[d].x, m_SegmentShrooms[d].y);
+	}
+
+
+	//collided with the player, restart the round
+	if (collision)
+	{
+		return loseLife();
+	}
+
+
+
+	// --- Advancing the match clock (the mushroom damage timers are measured against it) --- //
+	m_Time += dt;
+
+	//increment tick to 1000 before resetting it to 0
+	m_Tick = (m_Tick >= 1000) ? 0 : m_Tick + 1;
+	return PLAYING;
+}
+
+StepResult World::loseLife()
+{
+	// Checking if the match is over based on player health remaining
+	//if the ship isn't dead, go to the next round of the match
+	if (m_Ship.getHealth() > 0)
+	{
+		// not dead yet, start the next round
+		#ifdef DEBUG
+		printf("Restarting loop\n");
+		#endif
+		PROFILE_MARK("life lost");
+		startRound(m_Lives - 1);
+		return LIFE_LOST;
+	}
+
+	//no lives left, the match is over
+	PROFILE_MARK("match over");
+	m_Lives = 0;
+	return MATCH_OVER;
+}
+
+void World::setSeed(uint64_t seed)
+{
+	m_Random.setSeed(seed);
+}
+
+uint64_t World::getSeed()
+{
+	return m_Random.getSeed();
+}
+
+int World::getScore()
+{
+	return m_Score;
+}
+
+int World::getLives()
+{
+	return m_Lives;
+}
+
+float World::getWidth()
+{
+	return m_ScreenWidth;
+}
+
+float World::getHeight()
+{
+	return m_ScreenHeight;
+}
+
+MushroomStore& World::getMushrooms()
+{
+	return m_Mushrooms;
+}
+
+const MushroomGrid& World::getMushroomGrid()
+{
+	return m_MushroomGrid;
+}
+
+SlotMap<Centipede>& World::getCentipede()
+{
+	return m_Centipede.getSegments();
+}
+
+StarShip& World::getShip()
+{
+	return m_Ship;
+}
+
+Spider& World::getSpider()
+{
+	return m_Spider;
+}
@@ -0,0 +1,337 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the world class to:
+ - Hold every game object of a match (mushrooms, starship, spider, and centipede) without needing a window
+ - Step the game rules (movement, collisions, scoring, and round/life changes) from a plain logical width and height
+ - Let a front end (or a headless runner) read the state of the match to draw or measure it
+*/
+
+#pragma once
+#include "Geometry.h"
+#include "StarShip.h"
+#include "LaserPool.h"
+#include "MushroomStore.h"
+#include "Spider.h"
+#include "CentipedeChains.h"
+#include "MushroomGrid.h"
+#include "Broadphase.h"
+#include "SlotMap.h"
+#include "Random.h"
+#include <cstdint>
+#include <vector>
+
+// Public global types defined for class
+//the player actions that can be held down during a step of the world (combined as a bitmask)
+enum Action {
+    ACTION_LEFT  = 1 << 0,
+    ACTION_RIGHT = 1 << 1,
+    ACTION_UP    = 1 << 2,
+    ACTION_DOWN  = 1 << 3,
+    ACTION_SHOOT = 1 << 4,
+    ACTION_QUIT  = 1 << 5 //only recorded (the front end closes the window), the world ignores it
+};
+
+//the player inputs sampled for one step of the world, a bitmask of Actions
+typedef uint8_t Input;
+
+//what happened to the match during a step of the world
+enum StepResult {
+    PLAYING = 0,
+    LIFE_LOST = 1,
+    MATCH_OVER = 2
+};
+
+class World
+{
+private:
+    //creating the objects of the match
+    MushroomStore m_Mushrooms;
+    MushroomGrid m_MushroomGrid; //grid cell -> index in m_Mushrooms, kept in sync on every placement and removal
+    std::vector<int> m_GridHits; //mushrooms in the grid cells under the object being checked (grows to the widest area queried, a long swept laser covers many cells)
+    std::vector<SlotHandle> m_DeadShrooms; //mushrooms destroyed during the current step, removed once the mushroom checks are done
+    CentipedeChains m_Centipede; //every segment of the round's centipede, in the chains it has been shot into
+    Broadphase m_Broadphase; //the ship, lasers, spider, and segments kept sorted on x between steps to pair the ones that can touch
+    std::vector<Vec2> m_SegmentShrooms; //where segments were shot during the current step, turned into mushrooms at the end of it
+    LaserPool m_Lasers; //every laser the ship can have in flight, kept between rounds
+    StarShip m_Ship;
+    Spider m_Spider;
+    Random m_Random; //every random choice of the match comes from here so a seed always plays out the same
+
+    //setting constant values for the world
+    const int m_StartingLives = 3;
+    const int m_MaxShroomAttempts = 100; //how many overlapping spots in a row to try before the field counts as full
+
+    //creating the match settings (the defaults are the original game)
+    int m_StartingMushrooms = 60;
+    int m_StartingSegments = 15;
+
+    //creating changing values for the world
+    int m_Score = 0;
+    int m_Lives = 0; //how many lives are left in the match (including the current one)
+    int m_Tick = 0; //counts steps in the current round to periodically roll for the spider
+    double m_Time = 0; //seconds of game time since the match began
+
+    //creating screen values
+    float m_ScreenWidth;
+    float m_ScreenHeight;
+
+    /**
+     * Private function to create a new mushroom at the relative (could be random between 0 and 1) x and y coordinates
+     *
+     * Parameters:
+     * @param relativeX - the relative (percentage) x position of desired new mushroom
+     * @param relativeY - the relative (percentage) y position of desired new mushroom
+     *
+     * Returns:
+     * @return whether adding the mushroom was successful or not
+     */
+    bool createNewShroom(float relativeX, float relativeY);
+
+    /**
+     * Private function to create a new mushroom at the exact x and y coordinates (but on the grid)
+     *
+     * Parameters:
+     * @param exactX - the x position of desired new mushroom
+     * @param exactY - the y position of desired new mushroom
+     *
+     * Returns:
+     * @return whether adding the mushroom was successful or not
+     */
+    bool createNewShroomExact(float exactX, float exactY);
+
+    /**
+     * Private function to add a mushroom at a grid position if its cell is on the field and free
+     *
+     * Parameters:
+     * @param positionX - the grid snapped x position of the new mushroom
+     * @param positionY - the grid snapped y position of the new mushroom
+     *
+     * Returns:
+     * @return whether adding the mushroom was successful or not
+     */
+    bool placeShroom(float positionX, float positionY);
+
+    /**
+     * Private function to remove a mushroom by moving the last mushroom into its place (keeping the grid in sync)
+     *
+     * Parameters:
+     * @param handle - the handle of the mushroom to remove (nothing happens if it was already removed)
+     */
+    void removeShroom(SlotHandle handle);
+
+    /**
+     * Private function to damage a mushroom and move it to the health band it ends up in (keeping the grid in sync)
+     *
+     * Parameters:
+     * @param index - the index of the mushroom to damage
+     * @param damage - how much damage to try to do (the mushroom may ignore it if it was hit very recently)
+     */
+    void damageShroom(int index, int damage);
+
+    /**
+     * Private function to remove a shot centipede segment, shortening its chain or splitting it into two chains.
+     *  The segment's spot is saved to become a mushroom at the end of the step.
+     *
+     * Parameters:
+     * @param order - the order of the segment to remove (its place in the round's centipede, front to back)
+     */
+    void destroySegment(int order);
+
+    /**
+     * Private function to start a new round (player life) by recreating the ship, spider, and centipede.
+     *  The mushrooms and the score stay the same between rounds.
+     *
+     * Parameters:
+     * @param health - how many lives the player has left going into this round
+     */
+    void startRound(int health);
+
+    /**
+     * Private function to react to the player being hit by either starting the next round or ending the match.
+     *
+     * Returns:
+     * @return LIFE_LOST if there was another life to start, otherwise MATCH_OVER
+     */
+    StepResult loseLife();
+
+public:
+    /**
+     * Constructor for the World class to create an empty world of the given logical size.
+     *
+     * Parameters:
+     * @param screenWidth - the logical width of the playing field
+     * @param screenHeight - the logical height of the playing field
+     * @param seed - the seed for the world's random generator
+     */
+    World(float screenWidth, float screenHeight, uint64_t seed);
+
+    //worlds can't be copied since the spider points at the world's own random generator
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+
+
+    // Match methods
+
+    /**
+     * Function to restart the world's random generator so the next match plays out the same for the same seed and inputs.
+     *
+     * Parameters:
+     * @param seed - the new seed for the random generator
+     */
+    void setSeed(uint64_t seed);
+
+    /**
+     * Function to simply get the seed the world's random generator was last started from
+     *
+     * Returns:
+     * @return the seed value
+     */
+    uint64_t getSeed();
+
+    /**
+     * Function to change how many mushrooms and centipede segments the next matches start with (for benchmarks and tests).
+     *  If the field can't fit that many mushrooms, it is filled as far as it can be.
+     *
+     * Parameters:
+     * @param mushrooms - how many mushrooms to scatter over the field at the start of a match
+     * @param segments - how long the centipede is at the start of every round (at least 2, a head and a tail)
+     */
+    void setStartingCounts(int mushrooms, int segments);
+
+    /**
+     * Function to change how many lasers the ship can have in flight at once (for stress and weapon tests, the default is 30).
+     *  Every laser already in flight is put back in the pool.
+     *
+     * Parameters:
+     * @param capacity - how many lasers can be in flight at once
+     */
+    void setLaserCapacity(int capacity);
+
+    /**
+     * Function to begin a new match by resetting the score and lives, creating the mushroom field, and starting the first round.
+     */
+    void beginMatch();
+
+    /**
+     * Function to step the world forward once: apply the inputs, update every object, and react to collisions.
+     *  When the player is hit, the next round is started automatically if there are lives left.
+     *
+     * Parameters:
+     * @param dt - how long it has been (in seconds) since the last step to move the objects accordingly far
+     * @param input - bitmask of the player actions to apply to the starship for this step
+     *
+     * Returns:
+     * @return whether the match is still playing, a life was just lost, or the match is over
+     */
+    StepResult step(float dt, Input input);
+
+    /*  The three phases step() runs in order, public so benchmarks can time each one on its own.
+        Calling applyInput, updateObjects, then resolveCollisions is exactly the same as calling step. */
+
+    /**
+     * Function to apply the player's inputs to the starship (first phase of a step).
+     *
+     * Parameters:
+     * @param input - bitmask of the player actions to apply to the starship for this step
+     */
+    void applyInput(Input input);
+
+    /**
+     * Function to move every object and roll for the spider (second phase of a step).
+     *
+     * Parameters:
+     * @param dt - how long it has been (in seconds) since the last step to move the objects accordingly far
+     */
+    void updateObjects(float dt);
+
+    /**
+     * Function to check every collision, apply damage and scoring, and advance the match clock (last phase of a step).
+     *
+     * Parameters:
+     * @param dt - how long it has been (in seconds) since the last step to advance the match clock (for the mushroom damage delay)
+     *
+     * Returns:
+     * @return whether the match is still playing, a life was just lost, or the match is over
+     */
+    StepResult resolveCollisions(float dt);
+
+
+
+    // State methods (used to draw or measure the world)
+
+    /**
+     * Function to simply get the current score of the match
+     *
+     * Returns:
+     * @return the current score
+     */
+    int getScore();
+
+    /**
+     * Function to simply get the number of lives left in the match (including the current one)
+     *
+     * Returns:
+     * @return the number of lives left
+     */
+    int getLives();
+
+    /**
+     * Function to simply get the logical width of the playing field
+     *
+     * Returns:
+     * @return the width of the world
+     */
+    float getWidth();
+
+    /**
+     * Function to simply get the logical height of the playing field
+     *
+     * Returns:
+     * @return the height of the world
+     */
+    float getHeight();
+
+    /**
+     * Function to get the mushrooms currently in the field
+     *
+     * Returns:
+     * @return reference to the store of mushrooms
+     */
+    MushroomStore& getMushrooms();
+
+    /**
+     * Function to get the grid (and bitboards) indexing the mushrooms in the field
+     *
+     * Returns:
+     * @return reference to the mushroom grid
+     */
+    const MushroomGrid& getMushroomGrid();
+
+    /**
+     * Function to get the centipede segments currently alive (packed in no particular order)
+     *
+     * Returns:
+     * @return reference to the slot map of centipede segments
+     */
+    SlotMap<Centipede>& getCentipede();
+
+    /**
+     * Function to get the player's starship (and through it, the lasers)
+     *
+     * Returns:
+     * @return reference to the starship
+     */
+    StarShip& getShip();
+
+    /**
+     * Function to get the spider
+     *
+     * Returns:
+     * @return reference to the spider
+     */
+    Spider& getSpider();
+};
@@ -0,0 +1,172 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the batch runner which plays many complete, independent matches at once to:
+ - Spread the matches over every core with a work stealing thread pool (each worker owns its own world)
+ - Give every match its own seed and an automatic player (the fixed script or the bot)
+ - Sum up the score, lifetime, ticks simulated, and per-tick cost of all of the matches
+*/
+
+#include "World.h"
+#include "AutoPlayer.h"
+#include "FixedTimestep.h"
+#include "WorkStealingPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <vector>
+
+// Results of one match
+struct MatchResult
+{
+	unsigned long long seed = 0;
+	int score = 0;
+	long ticks = 0; //ticks simulated until the match ended (or hit the tick limit)
+	double seconds = 0; //wall time spent simulating the match
+	bool finished = false; //whether the match ended by itself before the tick limit
+};
+
+/**
+ * Function to get a value at a percentile of a sorted list.
+ *
+ * Parameters:
+ * @param sorted - the values, sorted from smallest to largest
+ * @param percentile - which percentile to get (0 to 100)
+ *
+ * Returns:
+ * @return the value at the percentile (0 if there are no values)
+ */
+double percentile(const std::vector<double>& sorted, double percentile)
+{
+	if (sorted.empty())
+	{
+		return 0;
+	}
+	size_t index = (size_t) (percentile / 100.0 * (sorted.size() - 1) + 0.5);
+	return sorted[std::min(index, sorted.size() - 1)];
+}
+
+/**
+ * Main function to parse the options, play every match on the thread pool, and print the summary.
+ *  Options: --matches N, --threads T (0 uses every core), --seed S (match i uses S + i),
+ *           --player scripted|bot, --max-ticks N (per match), --dt SECONDS, --width W, --height H
+ */
+int main(int argc, char** argv)
+{
+	// Reading the options
+	int matchCount = 1000;
+	int threadCount = 0;
+	unsigned long long seed = static_cast<unsigned long long>(std::time(nullptr));
+	PlayerKind kind = SCRIPTED_PLAYER;
+	float dt = FixedTimestep().getTickLength();
+	long maxTicks = (long) (600 / dt); //10 minutes of game time
+	float width = 1920;
+	float height = 1080;
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		if (std::strcmp(argv[i], "--matches") == 0)        matchCount = std::atoi(argv[i+1]);
+		else if (std::strcmp(argv[i], "--threads") == 0)   threadCount = std::atoi(argv[i+1]);
+		else if (std::strcmp(argv[i], "--seed") == 0)      seed = std::strtoull(argv[i+1], nullptr, 10);
+		else if (std::strcmp(argv[i], "--max-ticks") == 0) maxTicks = std::atol(argv[i+1]);
+		else if (std::strcmp(argv[i], "--dt") == 0)        dt = (float) std::atof(argv[i+1]);
+		else if (std::strcmp(argv[i], "--width") == 0)     width = (float) std::atof(argv[i+1]);
+		else if (std::strcmp(argv[i], "--height") == 0)    height = (float) std::atof(argv[i+1]);
+		else if (std::strcmp(argv[i], "--player") == 0 && std::strcmp(argv[i+1], "bot") == 0)      kind = BOT_PLAYER;
+		else if (std::strcmp(argv[i], "--player") == 0 && std::strcmp(argv[i+1], "scripted") == 0) kind = SCRIPTED_PLAYER;
+		else
+		{
+			printf("Unknown option: %s %s\n", argv[i], argv[i+1]);
+			return 1;
+		}
+	}
+	if (matchCount <= 0)
+	{
+		printf("Nothing to run\n");
+		return 1;
+	}
+
+	// Creating one world and player per worker (worlds are reused between that worker's matches)
+	WorkStealingPool pool(threadCount);
+	std::vector<std::unique_ptr<World>> worlds;
+	std::vector<AutoPlayer> players;
+	for (int i = 0; i < pool.getThreadCount(); ++i)
+	{
+		worlds.emplace_back(new World(width, height, seed));
+		players.emplace_back(kind);
+	}
+
+	// Playing every match on the pool
+	std::vector<MatchResult> results(matchCount);
+	auto start = std::chrono::steady_clock::now();
+	pool.run(matchCount, [&](int worker, int match)
+	{
+		//starting the match with its own seed
+		World& world = *worlds[worker];
+		AutoPlayer& player = players[worker];
+		unsigned long long matchSeed = seed + match;
+		world.setSeed(matchSeed);
+		world.beginMatch();
+		player.reset();
+
+		//stepping until game over or the tick limit
+		//the counts stay local so neighbouring matches on other workers don't fight over the cache lines of the results
+		auto matchStart = std::chrono::steady_clock::now();
+		long ticks = 0;
+		bool finished = false;
+		while (ticks < maxTicks && !finished)
+		{
+			finished = (world.step(dt, player.getInput(world, dt)) == MATCH_OVER);
+			ticks++;
+		}
+
+		//writing the result once the match is over
+		MatchResult& result = results[match];
+		result.seed = matchSeed;
+		result.ticks = ticks;
+		result.finished = finished;
+		result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - matchStart).count();
+		result.score = world.getScore();
+	});
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	// Summing up the results
+	long totalTicks = 0;
+	long long totalScore = 0;
+	double busySeconds = 0;
+	int finished = 0;
+	std::vector<double> scores, lifetimes, tickCosts;
+	for (const MatchResult& result : results)
+	{
+		totalTicks += result.ticks;
+		totalScore += result.score;
+		busySeconds += result.seconds;
+		finished += result.finished ? 1 : 0;
+		scores.push_back(result.score);
+		lifetimes.push_back(result.ticks * dt);
+		tickCosts.push_back((result.ticks > 0) ? result.seconds * 1e6 / result.ticks : 0.0);
+	}
+	std::sort(scores.begin(), scores.end());
+	std::sort(lifetimes.begin(), lifetimes.end());
+	std::sort(tickCosts.begin(), tickCosts.end());
+
+	// Printing the results
+	printf("matches:         %d (%d ended, %d hit the %ld tick limit), seeds %llu to %llu\n", matchCount, finished,
+		matchCount - finished, maxTicks, seed, seed + matchCount - 1);
+	printf("player:          %s\n", (kind == BOT_PLAYER) ? "bot" : "scripted");
+	printf("threads:         %d\n", pool.getThreadCount());
+	printf("score:           mean %.0f, p50 %.0f, min %.0f, max %.0f\n", (double) totalScore / matchCount,
+		percentile(scores, 50), scores.front(), scores.back());
+	printf("lifetime (s):    mean %.1f, p50 %.1f, min %.1f, max %.1f\n", totalTicks * dt / matchCount,
+		percentile(lifetimes, 50), lifetimes.front(), lifetimes.back());
+	printf("ticks simulated: %ld (%.0f per match)\n", totalTicks, (double) totalTicks / matchCount);
+	printf("us / tick:       mean %.3f, p50 %.3f, p99 %.3f (per match, on one thread)\n",
+		(totalTicks > 0) ? busySeconds * 1e6 / totalTicks : 0.0, percentile(tickCosts, 50), percentile(tickCosts, 99));
+	printf("wall time:       %.3f s (%.1f matches / s, %.0f ticks / s)\n", seconds, matchCount / seconds, totalTicks / seconds);
+	return 0;
+}
@@ -0,0 +1,370 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the benchmark runner which steps fixed, seeded scenarios of the world to:
+ - Time every phase of a tick (input, update, collision, and draw preparation) on its own, with draw preparation timed both with
+   the front end's mushroom layer (only changed cells) and without it (every mushroom every frame)
+ - Report the p50 / p95 / p99 / max time of every phase as JSON so runs before and after a change can be compared
+ - Cover the default field as well as heavy ones (many mushrooms, a long centipede, and every laser in flight, up to 2,000 of them)
+*/
+
+#include "World.h"
+#include "AutoPlayer.h"
+#include "FixedTimestep.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// A fixed, seeded setup of the world to measure
+struct Scenario
+{
+	const char* name;
+	float width;
+	float height;
+	int mushrooms;
+	int segments;
+	bool volley; //whether every one of the ship's lasers is kept in flight
+	int lasers; //how many lasers the ship can have in flight at once
+};
+
+// The phases of a tick that are timed
+enum Phase {
+	PHASE_INPUT = 0,
+	PHASE_UPDATE,
+	PHASE_COLLISION,
+	PHASE_DRAW_PREP,
+	PHASE_DRAW_PREP_NO_LAYER, //timed after the tick and left out of the total (the front end only does one of the two)
+	PHASE_TOTAL,
+	PHASE_COUNT
+};
+static const char* PHASE_NAMES[PHASE_COUNT] = { "input", "update", "collision", "drawPrep", "drawPrepNoLayer", "total" };
+
+// One textured rectangle the front end would draw (what draw preparation produces)
+struct DrawQuad
+{
+	float x, y, width, height;
+	int texture;
+};
+
+// What the front end keeps between frames to draw the mushroom layer (see GameRenderer::updateLayer)
+struct DrawLayer
+{
+	std::vector<uint64_t> bands[4]; //the health bands of the field the layer was last drawn from (one per MushroomGrid band)
+	std::vector<int> changed; //the cells being redrawn (kept to reuse its memory)
+	std::vector<int> bandShrooms; //the mushrooms of the band being gathered without a layer (kept to reuse its memory)
+};
+
+/**
+ * Function to add the moving objects the front end draws every frame (ship, lasers, spider, and centipede) to a list of quads.
+ *
+ * Parameters:
+ * @param world - the world to gather the quads of
+ * @param alpha - how far between the last two ticks to draw the objects
+ * @param quads - the list the quads are added to
+ */
+void prepareMovingDraw(World& world, float alpha, std::vector<DrawQuad>& quads)
+{
+	//ship and live lasers
+	StarShip& ship = world.getShip();
+	Vec2 position = ship.getInterpolatedPosition(alpha);
+	quads.push_back({ position.x, position.y, 20, 30, 0 });
+	LaserPool& lasers = ship.getLasers();
+	for (int i = 0; i < lasers.getActiveCount(); ++i)
+	{
+		if (lasers.getActive(i).getHealth() > 0)
+		{
+			position = lasers.getActive(i).getInterpolatedPosition(alpha);
+			quads.push_back({ position.x, position.y, 6, 16, 1 });
+		}
+	}
+
+	//spider if alive
+	Spider& spider = world.getSpider();
+	if (spider.getHealth() > 0)
+	{
+		position = spider.getInterpolatedPosition(alpha);
+		quads.push_back({ position.x, position.y, 60, 40, 6 });
+	}
+
+	//centipede segments
+	SlotMap<Centipede>& centipede = world.getCentipede();
+	for (int i = 0; i < (int) centipede.size(); ++i)
+	{
+		position = centipede[i].getInterpolatedPosition(alpha);
+		quads.push_back({ position.x, position.y, 35, 35, (centipede[i].getType() == HEAD) ? 7 : 8 });
+	}
+}
+
+/**
+ * Function to gather everything the front end draws for a world in a frame into a list of quads, the way GameRenderer::draw
+ *  does with its mushroom layer (without the SFML calls): only the cells whose mushroom changed since the last call get a
+ *  background patch and their mushroom, then every moving object is added.
+ *
+ * Parameters:
+ * @param world - the world to gather the quads of
+ * @param alpha - how far between the last two ticks to draw the objects
+ * @param layer - what is kept between frames to find the changed cells
+ * @param quads - cleared and filled with the quads to draw
+ */
+void prepareDraw(World& world, float alpha, DrawLayer& layer, std::vector<DrawQuad>& quads)
+{
+	quads.clear();
+
+	//finding the cells that look different than the last frame (the whole background is redrawn the first time)
+	const MushroomGrid& grid = world.getMushroomGrid();
+	layer.changed.clear();
+	bool matched = grid.gatherChanges(layer.bands, layer.changed);
+	float cellSize = MushroomGrid::getCellSize();
+	if (!matched)
+	{
+		quads.push_back({ 0, 0, world.getWidth(), world.getHeight(), 9 });
+	}
+
+	//a background patch for every changed cell and the mushroom still in it
+	MushroomStore& mushrooms = world.getMushrooms();
+	for (int i = 0; i < (int) layer.changed.size(); ++i)
+	{
+		int column = layer.changed[i] % grid.getColumns();
+		int row = layer.changed[i] / grid.getColumns();
+		if (matched)
+		{
+			quads.push_back({ column * cellSize, row * cellSize, cellSize, cellSize, 9 });
+		}
+		int index = grid.get(column, row);
+		if (index != -1)
+		{
+			Bounds bounds = mushrooms.getPosition(index);
+			quads.push_back({ bounds.left, bounds.top, bounds.width, bounds.height, 2 + MushroomGrid::getBand(mushrooms.getHealth(index)) });
+		}
+	}
+
+	//the moving objects on top
+	prepareMovingDraw(world, alpha, quads);
+}
+
+/**
+ * Function to gather everything the front end draws for a world in a frame into a list of quads, the way GameRenderer::draw
+ *  does when its mushroom layer couldn't be made: the background and every mushroom a health band at a time, then every moving object.
+ *
+ * Parameters:
+ * @param world - the world to gather the quads of
+ * @param alpha - how far between the last two ticks to draw the objects
+ * @param layer - holds the list the mushrooms of each band are gathered into
+ * @param quads - cleared and filled with the quads to draw
+ */
+void prepareDrawNoLayer(World& world, float alpha, DrawLayer& layer, std::vector<DrawQuad>& quads)
+{
+	quads.clear();
+	quads.push_back({ 0, 0, world.getWidth(), world.getHeight(), 9 });
+
+	//mushrooms a health band at a time (same as the game renderer)
+	MushroomStore& mushrooms = world.getMushrooms();
+	for (int band = 0; band < MushroomGrid::getBandCount(); ++band)
+	{
+		layer.bandShrooms.clear();
+		world.getMushroomGrid().gatherBand(band, layer.bandShrooms);
+		for (int m = 0; m < (int) layer.bandShrooms.size(); ++m)
+		{
+			Bounds bounds = mushrooms.getPosition(layer.bandShrooms[m]);
+			quads.push_back({ bounds.left, bounds.top, bounds.width, bounds.height, 2 + band });
+		}
+	}
+
+	//the moving objects on top
+	prepareMovingDraw(world, alpha, quads);
+}
+
+/**
+ * Function to get a value at a percentile of a sorted list.
+ *
+ * Parameters:
+ * @param sorted - the values, sorted from smallest to largest
+ * @param percentile - which percentile to get (0 to 100)
+ *
+ * Returns:
+ * @return the value at the percentile (0 if there are no values)
+ */
+double percentile(const std::vector<double>& sorted, double percentile)
+{
+	if (sorted.empty())
+	{
+		return 0;
+	}
+	size_t index = (size_t) (percentile / 100.0 * (sorted.size() - 1) + 0.5);
+	return sorted[std::min(index, sorted.size() - 1)];
+}
+
+/**
+ * Function to step a scenario for a number of ticks and write its timings as a JSON object.
+ *
+ * Parameters:
+ * @param scenario - the scenario to run
+ * @param ticks - how many ticks to time
+ * @param dt - the length of each tick in seconds
+ * @param seed - the seed of the world (and of the volley positions)
+ * @param out - where to write the JSON object
+ */
+void runScenario(const Scenario& scenario, long ticks, float dt, unsigned long long seed, FILE* out)
+{
+	//setting up the world and the scripted player
+	World world(scenario.width, scenario.height, seed);
+	world.setStartingCounts(scenario.mushrooms, scenario.segments);
+	world.setLaserCapacity(scenario.lasers);
+	world.beginMatch();
+	int startingMushrooms = (int) world.getMushrooms().size();
+	AutoPlayer player(SCRIPTED_PLAYER);
+	Random volleyRandom(seed);
+	std::vector<DrawQuad> quads;
+	std::vector<DrawQuad> quadsNoLayer;
+	DrawLayer layer;
+	std::vector<double> times[PHASE_COUNT];
+	for (int p = 0; p < PHASE_COUNT; ++p)
+	{
+		times[p].reserve(ticks);
+	}
+	int matchesEnded = 0;
+	size_t mostQuads = 0;
+	size_t mostQuadsNoLayer = 0;
+
+	//timing every phase of every tick
+	typedef std::chrono::steady_clock Clock;
+	for (long tick = 0; tick < ticks; ++tick)
+	{
+		//keeping every laser in flight for the volley scenario (not timed, it isn't part of the game)
+		if (scenario.volley)
+		{
+			LaserPool& lasers = world.getShip().getLasers();
+			while (lasers.getActiveCount() < lasers.getCapacity())
+			{
+				lasers.fire(volleyRandom.nextFloat() * scenario.width, scenario.height - 60);
+			}
+		}
+
+		Clock::time_point start = Clock::now();
+		world.applyInput(player.getInput(world, dt));
+		Clock::time_point inputDone = Clock::now();
+		world.updateObjects(dt);
+		Clock::time_point updateDone = Clock::now();
+		StepResult result = world.resolveCollisions(dt);
+		Clock::time_point collisionDone = Clock::now();
+		prepareDraw(world, 0.5f, layer, quads);
+		Clock::time_point drawDone = Clock::now();
+		prepareDrawNoLayer(world, 0.5f, layer, quadsNoLayer);
+		Clock::time_point noLayerDone = Clock::now();
+
+		times[PHASE_INPUT].push_back(std::chrono::duration<double, std::micro>(inputDone - start).count());
+		times[PHASE_UPDATE].push_back(std::chrono::duration<double, std::micro>(updateDone - inputDone).count());
+		times[PHASE_COLLISION].push_back(std::chrono::duration<double, std::micro>(collisionDone - updateDone).count());
+		times[PHASE_DRAW_PREP].push_back(std::chrono::duration<double, std::micro>(drawDone - collisionDone).count());
+		times[PHASE_DRAW_PREP_NO_LAYER].push_back(std::chrono::duration<double, std::micro>(noLayerDone - drawDone).count());
+		times[PHASE_TOTAL].push_back(std::chrono::duration<double, std::micro>(drawDone - start).count());
+		mostQuads = std::max(mostQuads, quads.size());
+		mostQuadsNoLayer = std::max(mostQuadsNoLayer, quadsNoLayer.size());
+
+		//restarting the match (with the same counts) when it ends so the load stays the same
+		if (result == MATCH_OVER)
+		{
+			matchesEnded++;
+			world.beginMatch();
+			player.reset();
+		}
+	}
+
+	//writing the scenario and the percentiles of every phase
+	fprintf(out, "    {\n      \"name\": \"%s\", \"width\": %.0f, \"height\": %.0f, \"mushrooms\": %d, \"segments\": %d, \"volley\": %s, \"lasers\": %d,\n",
+		scenario.name, scenario.width, scenario.height, startingMushrooms, scenario.segments, scenario.volley ? "true" : "false",
+		scenario.lasers);
+	fprintf(out, "      \"ticks\": %ld, \"matchesEnded\": %d, \"mostQuads\": %zu, \"mostQuadsNoLayer\": %zu,\n      \"phases\": {\n", ticks, matchesEnded,
+		mostQuads, mostQuadsNoLayer);
+	for (int p = 0; p < PHASE_COUNT; ++p)
+	{
+		std::vector<double>& sorted = times[p];
+		double sum = 0;
+		for (double time : sorted)
+		{
+			sum += time;
+		}
+		std::sort(sorted.begin(), sorted.end());
+		fprintf(out, "        \"%s\": { \"mean_us\": %.3f, \"p50_us\": %.3f, \"p95_us\": %.3f, \"p99_us\": %.3f, \"max_us\": %.3f }%s\n",
+			PHASE_NAMES[p], sorted.empty() ? 0.0 : sum / sorted.size(), percentile(sorted, 50), percentile(sorted, 95),
+			percentile(sorted, 99), sorted.empty() ? 0.0 : sorted.back(), (p + 1 < PHASE_COUNT) ? "," : "");
+	}
+	fprintf(out, "      }\n    }");
+}
+
+/**
+ * Main function to parse the options, run every (or the chosen) scenario, and write the JSON report.
+ *  Options: --ticks N (per scenario), --seed S, --scenario NAME (only run that one), --out FILE (defaults to the console)
+ */
+int main(int argc, char** argv)
+{
+	// The fixed scenarios (2,000 and 10,000 mushrooms need a bigger field than the default screen can fit)
+	const Scenario scenarios[] = {
+		{ "default",        1920, 1080,   60,  15, false,   30 },
+		{ "mushrooms_2000", 3840, 2160, 2000,  15, false,   30 },
+		{ "mushrooms_10000", 7680, 4320, 10000, 15, false,  30 },
+		{ "centipede_500",  1920, 1080,   60, 500, false,   30 },
+		{ "lasers_30",      1920, 1080,   60,  15, true,    30 },
+		{ "lasers_2000",    3840, 2160, 2000,  15, true,  2000 },
+	};
+
+	// Reading the options
+	long ticks = 20000;
+	unsigned long long seed = 1;
+	float dt = FixedTimestep().getTickLength();
+	std::string only;
+	std::string outPath;
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		if (std::strcmp(argv[i], "--ticks") == 0)         ticks = std::atol(argv[i+1]);
+		else if (std::strcmp(argv[i], "--seed") == 0)     seed = std::strtoull(argv[i+1], nullptr, 10);
+		else if (std::strcmp(argv[i], "--scenario") == 0) only = argv[i+1];
+		else if (std::strcmp(argv[i], "--out") == 0)      outPath = argv[i+1];
+		else
+		{
+			printf("Unknown option: %s\n", argv[i]);
+			return 1;
+		}
+	}
+
+	// Opening the report
+	FILE* out = outPath.empty() ? stdout : std::fopen(outPath.c_str(), "w");
+	if (out == nullptr)
+	{
+		printf("Could not create report file: %s\n", outPath.c_str());
+		return 1;
+	}
+
+	// Running the scenarios
+	fprintf(out, "{\n  \"seed\": %llu, \"dt\": %.6f, \"ticksPerScenario\": %ld,\n", seed, dt, ticks);
+	fprintf(out, "  \"notMeasured\": [\"display\"],\n  \"scenarios\": [\n");
+	bool first = true;
+	for (const Scenario& scenario : scenarios)
+	{
+		if (!only.empty() && only != scenario.name)
+		{
+			continue;
+		}
+		fprintf(out, first ? "" : ",\n");
+		runScenario(scenario, ticks, dt, seed, out);
+		first = false;
+	}
+	fprintf(out, "\n  ]\n}\n");
+
+	if (out != stdout)
+	{
+		std::fclose(out);
+	}
+	if (first)
+	{
+		printf("Unknown scenario: %s\n", only.c_str());
+		return 1;
+	}
+	return 0;
+}
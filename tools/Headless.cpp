@@ -0,0 +1,180 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the headless runner which steps the centipede world without a window to:
+ - Play matches back to back with an automatic player (scripted or bot) for a set number of ticks
+ - Replay recorded matches (from the game's --record option) as fast as possible with no frame pacing
+ - Measure how fast the game rules simulate on their own (no drawing or frame presenting)
+*/
+
+#include "World.h"
+#include "AutoPlayer.h"
+#include "FixedTimestep.h"
+#include "InputRecording.h"
+#include "Profiler.h"
+#include "TraceWriter.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+
+/**
+ * Function to replay every match of a recording through the world as fast as possible.
+ *
+ * Parameters:
+ * @param path - the recording file to replay
+ *
+ * Returns:
+ * @return the program exit code
+ */
+int replay(const std::string& path)
+{
+	//reading the recording
+	InputPlayback playback;
+	if (!playback.open(path))
+	{
+		printf("Could not read recording: %s\n", path.c_str());
+		return 1;
+	}
+	World world(playback.getWidth(), playback.getHeight(), 0);
+	float dt = 1.0f / playback.getTickRate();
+
+	//stepping every recorded match with its seed and inputs
+	long totalTicks = 0;
+	uint64_t seed;
+	auto start = std::chrono::steady_clock::now();
+	for (int match = 1; playback.nextMatch(seed); ++match)
+	{
+		world.setSeed(seed);
+		world.beginMatch();
+
+		long ticks = 0;
+		Input input;
+		StepResult result = PLAYING;
+		while (result != MATCH_OVER && playback.nextInput(input))
+		{
+			result = world.step(dt, input);
+			ticks++;
+		}
+		totalTicks += ticks;
+		printf("match %d: seed %llu, %ld ticks (%.1f s of game time), score %d%s\n", match, (unsigned long long) seed,
+			ticks, ticks * dt, world.getScore(), (result == MATCH_OVER) ? "" : " (quit before game over)");
+	}
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	// Printing the results
+	printf("ticks:           %ld (%.1f s of game time)\n", totalTicks, totalTicks * dt);
+	printf("wall time:       %.3f s (%.0fx real time)\n", seconds, (seconds > 0) ? totalTicks * dt / seconds : 0.0);
+	printf("ticks / second:  %.0f\n", (seconds > 0) ? totalTicks / seconds : 0.0);
+	return 0;
+}
+
+/**
+ * Main function to parse the options, run the world for the requested ticks, and print the throughput.
+ *  Options: --ticks N, --dt SECONDS (defaults to the game's fixed tick), --width W, --height H, --seed S,
+ *           --player scripted|bot, --record FILE to save the played matches, --replay FILE to replay a recording instead,
+ *           --trace FILE to write every tick's zones as Chrome / Perfetto trace JSON (keep --ticks small, every tick is a frame)
+ */
+int main(int argc, char** argv)
+{
+	// Reading the options
+	long ticks = 100000;
+	float dt = FixedTimestep().getTickLength();
+	float width = 1920;
+	float height = 1080;
+	unsigned long long seed = static_cast<unsigned long long>(std::time(nullptr));
+	PlayerKind kind = SCRIPTED_PLAYER;
+	std::string recordPath;
+	std::string tracePath;
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		if (std::strcmp(argv[i], "--ticks") == 0)       ticks = std::atol(argv[i+1]);
+		else if (std::strcmp(argv[i], "--dt") == 0)     dt = (float) std::atof(argv[i+1]);
+		else if (std::strcmp(argv[i], "--width") == 0)  width = (float) std::atof(argv[i+1]);
+		else if (std::strcmp(argv[i], "--height") == 0) height = (float) std::atof(argv[i+1]);
+		else if (std::strcmp(argv[i], "--seed") == 0)   seed = std::strtoull(argv[i+1], nullptr, 10);
+		else if (std::strcmp(argv[i], "--record") == 0) recordPath = argv[i+1];
+		else if (std::strcmp(argv[i], "--trace") == 0)  tracePath = argv[i+1];
+		else if (std::strcmp(argv[i], "--player") == 0) kind = (std::strcmp(argv[i+1], "bot") == 0) ? BOT_PLAYER : SCRIPTED_PLAYER;
+		else if (std::strcmp(argv[i], "--replay") == 0) return replay(argv[i+1]);
+		else
+		{
+			printf("Unknown option: %s\n", argv[i]);
+			return 1;
+		}
+	}
+
+	// Opening the recording if asked for
+	InputRecorder recorder;
+	bool recording = !recordPath.empty();
+	if (recording && !recorder.open(recordPath, width, height, 1.0f / dt))
+	{
+		printf("Could not create recording file: %s\n", recordPath.c_str());
+		return 1;
+	}
+
+	// Opening the trace if asked for (every tick is traced as a frame)
+	Profiler profiler;
+	TraceWriter trace;
+	bool tracing = !tracePath.empty();
+	if (tracing)
+	{
+		if (!trace.open(tracePath))
+		{
+			printf("Could not create trace file: %s\n", tracePath.c_str());
+			return 1;
+		}
+		profiler.setTrace(&trace);
+		Profiler::setActive(&profiler);
+	}
+
+	// Running the matches back to back (each one gets the next seed)
+	World world(width, height, seed);
+	AutoPlayer player(kind);
+	world.beginMatch();
+	if (recording) recorder.beginMatch(seed);
+	int matches = 0;
+	long bestScore = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	for (long tick = 0; tick < ticks; ++tick)
+	{
+		if (tracing) profiler.nextFrame();
+		Input input = player.getInput(world, dt);
+		StepResult result = world.step(dt, input);
+		if (recording) recorder.record(input);
+		if (result == MATCH_OVER)
+		{
+			//match is over, save the score and start the next one
+			bestScore = (world.getScore() > bestScore) ? world.getScore() : bestScore;
+			matches++;
+			world.setSeed(seed + matches);
+			world.beginMatch();
+			player.reset();
+			if (recording) recorder.beginMatch(seed + matches);
+		}
+	}
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	recorder.close();
+	if (tracing)
+	{
+		profiler.endFrame();
+		profiler.setTrace(nullptr);
+		Profiler::setActive(nullptr);
+		trace.close();
+	}
+
+	// Printing the results
+	printf("seed:            %llu\n", seed);
+	printf("ticks:           %ld (%.1f s of game time)\n", ticks, ticks * dt);
+	printf("matches ended:   %d\n", matches);
+	printf("best score:      %ld\n", bestScore);
+	printf("wall time:       %.3f s\n", seconds);
+	printf("ticks / second:  %.0f\n", ticks / seconds);
+	printf("us / tick:       %.3f\n", seconds * 1e6 / ticks);
+	return 0;
+}
@@ -0,0 +1,132 @@
+/*
+Author: Dawson Pent
+Last Date Modified: 10/17/26
+
+Description:
+This is the header file which describes the work stealing thread pool class to:
+ - Split a batch of independent jobs (numbered 0 to count - 1) across a set of worker threads
+ - Let a worker that runs out of its own jobs take the oldest jobs from another worker's queue,
+   so uneven job lengths (short and long matches) still keep every core busy until the end
+*/
+
+#pragma once
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkStealingPool
+{
+private:
+	//a single worker's queue of job numbers (own jobs come off the back, stolen jobs off the front)
+	struct WorkQueue
+	{
+		std::mutex lock;
+		std::deque<int> jobs;
+	};
+
+	//creating the worker values
+	int m_ThreadCount;
+
+	/**
+	 * Private function to take the next job for a worker, first from its own queue and then from the others.
+	 *
+	 * Parameters:
+	 * @param queues - every worker's queue
+	 * @param worker - the number of the worker looking for a job
+	 * @param job - written with the job that was taken
+	 *
+	 * Returns:
+	 * @return whether a job was found (false once every queue is empty)
+	 */
+	static bool takeJob(std::vector<WorkQueue>& queues, int worker, int& job)
+	{
+		//taking the newest job of its own queue
+		{
+			std::lock_guard<std::mutex> guard(queues[worker].lock);
+			if (!queues[worker].jobs.empty())
+			{
+				job = queues[worker].jobs.back();
+				queues[worker].jobs.pop_back();
+				return true;
+			}
+		}
+
+		//stealing the oldest job of the next busy worker
+		int count = (int) queues.size();
+		for (int i = 1; i < count; ++i)
+		{
+			WorkQueue& victim = queues[(worker + i) % count];
+			std::lock_guard<std::mutex> guard(victim.lock);
+			if (!victim.jobs.empty())
+			{
+				job = victim.jobs.front();
+				victim.jobs.pop_front();
+				return true;
+			}
+		}
+		return false;
+	}
+
+public:
+	/**
+	 * Constructor for the WorkStealingPool class.
+	 *
+	 * Parameters:
+	 * @param threadCount - how many worker threads to run (0 uses one per hardware thread)
+	 */
+	WorkStealingPool(int threadCount = 0)
+	{
+		m_ThreadCount = (threadCount > 0) ? threadCount : (int) std::thread::hardware_concurrency();
+		m_ThreadCount = (m_ThreadCount > 0) ? m_ThreadCount : 1;
+	}
+
+	/**
+	 * Function to simply get how many worker threads the pool runs
+	 *
+	 * Returns:
+	 * @return the number of worker threads
+	 */
+	int getThreadCount() const { return m_ThreadCount; }
+
+	/**
+	 * Function to run every job of a batch and wait for all of them to finish.
+	 *  Jobs are dealt out round robin up front and then stolen between workers as queues empty.
+	 *
+	 * Parameters:
+	 * @param jobCount - how many jobs to run
+	 * @param job - called once for every job with the worker number and the job number
+	 */
+	void run(int jobCount, const std::function<void(int worker, int job)>& job)
+	{
+		//dealing the jobs out to the worker queues
+		std::vector<WorkQueue> queues(m_ThreadCount);
+		for (int i = 0; i < jobCount; ++i)
+		{
+			queues[i % m_ThreadCount].jobs.push_back(i);
+		}
+
+		//starting the workers (the calling thread is worker 0)
+		auto work = [&queues, &job](int worker)
+		{
+			int next;
+			while (takeJob(queues, worker, next))
+			{
+				job(worker, next);
+			}
+		};
+		std::vector<std::thread> threads;
+		for (int worker = 1; worker < m_ThreadCount; ++worker)
+		{
+			threads.emplace_back(work, worker);
+		}
+		work(0);
+
+		//waiting for every worker to run out of jobs
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+	}
+};